@@ -203,6 +203,19 @@ public:
 	 */
 	MMINLINE void completeMarking(MM_EnvironmentBase *env) { }
 
+	/**
+	 * This method is called for indexable objects larger than markingArraySplitThreshold before they are scanned.
+	 * The marking scheme only splits an array into ranges of element indices if every element of the array is
+	 * exactly one object reference slot, so the scanner reports every element in a range as a slot to scan.
+	 *
+	 * The example object model has no indexable objects, so this always answers false.
+	 *
+	 * @param env The environment for the calling thread
+	 * @param objectPtr The indexable object to be scanned
+	 * @return true if the object is an array of object references
+	 */
+	MMINLINE bool isReferenceArray(MM_EnvironmentBase *env, omrobjectptr_t objectPtr) { return false; }
+
 	uintptr_t setupIndexableScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_MarkingSchemeScanReason reason, uintptr_t *sizeToDo, uintptr_t *sizeInElementsToDo, fomrobject_t **basePtr, uintptr_t *flags) { return 0; }
 
 	/**
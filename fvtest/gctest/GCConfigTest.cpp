@@ -43,12 +43,35 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lockfree_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_portablesweep_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_batchclear_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_tlhadaptive_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_asynclog_config.xml"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+                        , "fvtest/gctest/configuration/global_GC_gccost_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_idlerelease_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compactincrement_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_compactsummary_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_pacing_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/optavgpause_GC_concurrentsweep_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+                        , "fvtest/gctest/configuration/optavgpause_GC_satb_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_stealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptivecache_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -58,6 +81,9 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
 								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+
+/* run with -GCPolicy, -memoryMax and -gcthreadCount to vary the collector configuration (see omrperftest.mk) */
+const char *benchmarkTests[] = {"perftest/gctest/configuration/benchmark_workload.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -108,7 +134,20 @@ GCConfigTest::SetUp()
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
 	}
-	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	/* name the overridden configuration in the log, so the results of each combination are told apart */
+	char overrideTag[MAX_NAME_LENGTH] = "";
+	if (NULL != gcTestEnv->gcPolicyOverride) {
+		omrstr_printf(overrideTag, MAX_NAME_LENGTH, "-%s", gcTestEnv->gcPolicyOverride);
+	}
+	if (0 != gcTestEnv->memoryMaxOverride) {
+		uintptr_t tagLength = strlen(overrideTag);
+		omrstr_printf(overrideTag + tagLength, MAX_NAME_LENGTH - tagLength, "-%zuMB", gcTestEnv->memoryMaxOverride);
+	}
+	if (0 != gcTestEnv->gcThreadCountOverride) {
+		uintptr_t tagLength = strlen(overrideTag);
+		omrstr_printf(overrideTag + tagLength, MAX_NAME_LENGTH - tagLength, "-%zuthreads", gcTestEnv->gcThreadCountOverride);
+	}
+	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s%s_%d_%lld.xml", verboseFileNamePrefix, overrideTag, omrsysinfo_get_pid(), omrtime_current_time_millis());
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
 	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
@@ -152,6 +191,10 @@ GCConfigTest::TearDown()
 		verboseManager->kill(env);
 		verboseManager = NULL;
 	}
+	/* with the streams closed every verbose log must be complete; a log cut short or interleaved does not parse */
+	if (NULL != verboseFile) {
+		EXPECT_EQ(0, verifyVerboseLogsWellFormed()) << "Verbose log is not well-formed.";
+	}
 	if ((NULL != verboseFile) && (false == gcTestEnv->keepLog)) {
 		if (0 == numOfFiles) {
 			J9FileStat buf;
@@ -906,6 +949,36 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::verifyVerboseLogsWellFormed()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t seq = 1;
+
+	do {
+		char currentVerboseFile[MAX_NAME_LENGTH];
+		if (0 == numOfFiles) {
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s", verboseFile);
+		} else {
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq);
+		}
+		seq += 1;
+
+		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+		if (pugi::status_file_not_found == result.status) {
+			break;
+		}
+		if (!result) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "*FAILED* Verbose log %s is not well-formed: %s at offset %lld.\n", currentVerboseFile, result.description(), (long long)result.offset);
+		}
+	} while (seq <= numOfFiles);
+
+	return rt;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -973,6 +1046,11 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* leave the heap untouched so that background GC threads can act on it */
+			int64_t millis = (int64_t)atoi(node.attribute("millis").value());
+			gcTestEnv->log("Idling for %lld ms...\n", millis);
+			omrthread_sleep(millis);
 		}
 	}
 done:
@@ -1064,3 +1142,6 @@ INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
 
 INSTANTIATE_TEST_CASE_P(perfTest,GCConfigTest,
         ::testing::ValuesIn(perfTests));
+
+INSTANTIATE_TEST_CASE_P(benchmarkTest,GCConfigTest,
+        ::testing::ValuesIn(benchmarkTests));
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(GCHEAPTEST_HPP_INCLUDED)
+#define GCHEAPTEST_HPP_INCLUDED
+
+#include "CollectorLanguageInterface.hpp"
+#include "EnvironmentBase.hpp"
+#include "gcTestHelpers.hpp"
+
+/**
+ * Fixture for unit tests of GC components that need a live environment, extensions and heap.
+ * The heap and collector are initialized from a configuration file and the calling thread is
+ * attached to the example VM, so tests can instantiate GC objects with a real MM_EnvironmentBase.
+ */
+class GCHeapTest : public ::testing::Test
+{
+	/*
+	 * Data members
+	 */
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_CollectorLanguageInterface *cli;
+
+	/*
+	 * Function members
+	 */
+protected:
+	/**
+	 * @return the configuration file the heap and collector are initialized from
+	 */
+	virtual const char *getConfiguration() { return "fvtest/gctest/configuration/global_GC_config.xml"; }
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+public:
+	GCHeapTest()
+		: ::testing::Test()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, cli(NULL)
+	{
+	}
+};
+
+#endif /* GCHEAPTEST_HPP_INCLUDED */
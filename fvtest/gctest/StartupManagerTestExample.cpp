@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -101,11 +102,78 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "snapshotAtTheBeginningBarrier")) {
+					extensions->configurationOptions._forceOptionWriteBarrierSATB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_REALTIME)
+				} else if (0 == strcmp(attr.name(), "satbPacketPublishBatchSize")) {
+					extensions->satbPacketPublishBatchSize = atoi(attr.value());
+#endif /* defined(OMR_GC_REALTIME) */
+				} else if (0 == strcmp(attr.name(), "concurrentPacing")) {
+					extensions->concurrentPacing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSweepBackground")) {
+					extensions->concurrentSweepBackground = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+				} else if (0 == strcmp(attr.name(), "markingArraySplitThreshold")) {
+					extensions->markingArraySplitThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workPacketsLockFree")) {
+					extensions->workPacketsLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "parSweepVectorKernel")) {
+					extensions->parSweepVectorKernel = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "splitFreeListTryLock")) {
+					extensions->splitFreeListTryLock = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asynchronousLogging")) {
+					extensions->asynchronousLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapResizePolicy")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "gcCost")) {
+						extensions->heapResizePolicy = MM_GCExtensionsBase::HEAP_RESIZE_POLICY_GC_COST;
+					} else {
+						extensions->heapResizePolicy = MM_GCExtensionsBase::HEAP_RESIZE_POLICY_FREE_RATIO;
+					}
+				} else if (0 == strcmp(attr.name(), "heapResizeTargetGCPercentage")) {
+					extensions->heapResizeTargetGCPercentage = atoi(attr.value());
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				} else if (0 == strcmp(attr.name(), "idleHeapRelease")) {
+					extensions->idleHeapRelease = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "idleHeapReleaseIntervalMillis")) {
+					extensions->idleHeapReleaseIntervalMillis = atoi(attr.value());
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnSystemGC")) {
+					extensions->compactOnSystemGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->nocompactOnSystemGC = (0 == extensions->compactOnSystemGC) ? 1 : 0;
+					if (1 == extensions->compactOnSystemGC) {
+						/* compaction is disabled outright by default */
+						extensions->noCompactOnGlobalGC = 0;
+					}
+				} else if (0 == strcmp(attr.name(), "compactIncrementSubAreaLimit")) {
+					extensions->compactIncrementSubAreaLimit = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "compactForwardingSummary")) {
+					extensions->compactForwardingSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "batchClearTLHNonTemporal")) {
+					extensions->batchClearTLHNonTemporal = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scanCacheStealing")) {
+					extensions->scavengerScanCacheStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scanPrefetchDistance")) {
+					extensions->scavengerScanPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveScanCacheSize")) {
+					extensions->scavengerAdaptiveScanCacheSize = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -113,6 +181,55 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					result = false;
 				}
 			}
+
+			/* command line overrides run one benchmark workload across policies, heap sizes and thread counts */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			bool layoutNursery = (0 != gcTestEnv->memoryMaxOverride);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+			if (NULL != gcTestEnv->gcPolicyOverride) {
+				if (0 == j9_cmdla_stricmp(gcTestEnv->gcPolicyOverride, "gencon")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+					extensions->scavengerEnabled = true;
+					/* the workload may come from a flat heap configuration that never sized a nursery */
+					layoutNursery = true;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "Failed: -GCPolicy=gencon requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
+					result = false;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == j9_cmdla_stricmp(gcTestEnv->gcPolicyOverride, "optavgpause")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+					extensions->scavengerEnabled = false;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else {
+					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized -GCPolicy (expected gencon or optavgpause): %s\n", gcTestEnv->gcPolicyOverride);
+					result = false;
+				}
+			}
+			if (0 != gcTestEnv->memoryMaxOverride) {
+				uintptr_t heapSize = gcTestEnv->memoryMaxOverride * 1024 * 1024;
+				extensions->memoryMax = heapSize;
+				extensions->initialMemorySize = heapSize;
+				extensions->maxSizeDefaultMemorySpace = heapSize;
+			}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			if (layoutNursery && extensions->scavengerEnabled) {
+				/* a fixed nursery of a quarter of the heap */
+				uintptr_t heapSize = extensions->memoryMax;
+				uintptr_t newSpaceSize = heapSize / 4;
+				extensions->initialMemorySize = heapSize;
+				extensions->maxSizeDefaultMemorySpace = heapSize;
+				extensions->minNewSpaceSize = newSpaceSize;
+				extensions->newSpaceSize = newSpaceSize;
+				extensions->maxNewSpaceSize = newSpaceSize;
+				extensions->minOldSpaceSize = heapSize - newSpaceSize;
+				extensions->oldSpaceSize = heapSize - newSpaceSize;
+				extensions->maxOldSpaceSize = heapSize - newSpaceSize;
+			}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+			if (0 != gcTestEnv->gcThreadCountOverride) {
+				extensions->gcThreadCount = gcTestEnv->gcThreadCountOverride;
+				extensions->gcThreadCountForced = true;
+			}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
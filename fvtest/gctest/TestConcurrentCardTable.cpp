@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentCardTable.hpp"
+
+#include <gtest/gtest.h>
+
+#define SLOTS_PER_BLOCK (CARD_SCAN_BLOCK_SIZE / sizeof(uintptr_t))
+#define TABLE_SLOTS ((5 * SLOTS_PER_BLOCK) + 3)
+#define TABLE_CARDS (TABLE_SLOTS * sizeof(uintptr_t))
+
+enum CardPattern {
+    ALL_CLEAN = 0,
+    SPARSE,
+    DENSE,
+    LAST_CARD_OF_FIRST_BLOCK,
+    FIRST_CARD_OF_SECOND_BLOCK,
+    LAST_CARD_OF_TABLE,
+    PATTERN_COUNT
+};
+
+class TestConcurrentCardTable : public ::testing::Test
+{
+protected:
+    uintptr_t slots[TABLE_SLOTS];
+    Card *cards;
+
+    virtual void
+    SetUp()
+    {
+        cards = (Card *)slots;
+    }
+
+    void
+    fill(CardPattern pattern)
+    {
+        for (uintptr_t index = 0; index < TABLE_CARDS; index++) {
+            bool dirty = false;
+            switch (pattern) {
+            case SPARSE:
+                /* a step that is not a multiple of the slot or block size lands on every offset within them */
+                dirty = (5 == (index % 97));
+                break;
+            case DENSE:
+                dirty = (0 != (index % 3));
+                break;
+            case LAST_CARD_OF_FIRST_BLOCK:
+                dirty = ((CARD_SCAN_BLOCK_SIZE - 1) == index);
+                break;
+            case FIRST_CARD_OF_SECOND_BLOCK:
+                dirty = (CARD_SCAN_BLOCK_SIZE == index);
+                break;
+            case LAST_CARD_OF_TABLE:
+                dirty = ((TABLE_CARDS - 1) == index);
+                break;
+            default:
+                break;
+            }
+            cards[index] = dirty ? (Card)CARD_DIRTY : (Card)CARD_CLEAN;
+        }
+    }
+
+    static uintptr_t *
+    skipCleanSlotsOneAtATime(uintptr_t *nextSlot, uintptr_t *lastSlot)
+    {
+        while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
+            nextSlot += 1;
+        }
+        return nextSlot;
+    }
+};
+
+TEST_F(TestConcurrentCardTable, SkipCleanSlotsMatchesSlotBySlotScan)
+{
+    for (uintptr_t pattern = ALL_CLEAN; pattern < PATTERN_COUNT; pattern++) {
+        fill((CardPattern)pattern);
+        /* every start and end slot, so runs begin and end on and off block boundaries */
+        for (uintptr_t start = 0; start <= TABLE_SLOTS; start++) {
+            for (uintptr_t end = start; end <= TABLE_SLOTS; end++) {
+                ASSERT_EQ(skipCleanSlotsOneAtATime(slots + start, slots + end), MM_ConcurrentCardTable::skipCleanSlots(slots + start, slots + end))
+                    << "pattern " << pattern << " start slot " << start << " end slot " << end;
+            }
+        }
+    }
+}
+
+TEST_F(TestConcurrentCardTable, SkipCleanCardsStopsAtLastWholeSlot)
+{
+    for (uintptr_t pattern = ALL_CLEAN; pattern < PATTERN_COUNT; pattern++) {
+        fill((CardPattern)pattern);
+        for (uintptr_t start = 0; start < TABLE_CARDS; start += sizeof(uintptr_t)) {
+            /* end cards at every offset within a slot, as a prepare unit of the WC card table may end anywhere */
+            for (uintptr_t end = start; end <= TABLE_CARDS; end++) {
+                uintptr_t lastWholeSlotCard = end - (end % sizeof(uintptr_t));
+                Card *result = MM_ConcurrentCardTable::skipCleanCards(cards + start, cards + end);
+                uintptr_t resultCard = (uintptr_t)(result - cards);
+
+                ASSERT_EQ(0u, resultCard % sizeof(uintptr_t)) << "pattern " << pattern << " start " << start << " end " << end;
+                ASSERT_LE(resultCard, lastWholeSlotCard) << "pattern " << pattern << " start " << start << " end " << end;
+                for (uintptr_t index = start; index < resultCard; index++) {
+                    ASSERT_EQ((Card)CARD_CLEAN, cards[index]) << "pattern " << pattern << " start " << start << " end " << end << " skipped card " << index;
+                }
+                if (resultCard < lastWholeSlotCard) {
+                    /* it stopped early, so the slot it stopped at must hold a card that is not clean */
+                    ASSERT_NE(SLOT_ALL_CLEAN, slots[resultCard / sizeof(uintptr_t)]) << "pattern " << pattern << " start " << start << " end " << end;
+                }
+            }
+        }
+    }
+}
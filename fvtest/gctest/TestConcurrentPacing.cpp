@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "ConcurrentGC.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestConcurrentPacing, HelpersShortenMarkTime)
+{
+    /* without a helper measurement the tax alone must finish before free memory runs out */
+    EXPECT_FLOAT_EQ(MM_ConcurrentGC::getPacedMarkTime(100, 0, 2), 100);
+    EXPECT_FLOAT_EQ(MM_ConcurrentGC::getPacedMarkTime(0, 50, 2), 0);
+
+    /* helpers that need as long as the tax alone halve the marking time */
+    EXPECT_FLOAT_EQ(MM_ConcurrentGC::getPacedMarkTime(100, 100, 4), 50);
+
+    /* slow helpers barely help; the mark time still shrinks but never grows */
+    float slowHelpers = MM_ConcurrentGC::getPacedMarkTime(100, 900, 4);
+    EXPECT_FLOAT_EQ(slowHelpers, 90);
+
+    /* fast helpers are capped at the maximum trace rate, as they slow down when mutators compete for CPU */
+    EXPECT_FLOAT_EQ(MM_ConcurrentGC::getPacedMarkTime(100, 10, 2), 50);
+    EXPECT_FLOAT_EQ(MM_ConcurrentGC::getPacedMarkTime(100, 10, 1), 100);
+}
+
+TEST(TestConcurrentPacing, MarkTimeTracksAllocationTiming)
+{
+    /* the same trace work against a faster allocator leaves less time, so helpers cover a larger share of it */
+    float traceTarget = 64 * 1024 * 1024;
+    float helperRate = 16 * 1024;
+    float taxedThreshold = 8 * 1024 * 1024;
+    float helperTraceTime = traceTarget / helperRate;
+
+    float slowAllocationRate = 1024;
+    float fastAllocationRate = 64 * 1024;
+    float slowThreshold = MM_ConcurrentGC::getPacedMarkTime(taxedThreshold / slowAllocationRate, helperTraceTime, 8) * slowAllocationRate;
+    float fastThreshold = MM_ConcurrentGC::getPacedMarkTime(taxedThreshold / fastAllocationRate, helperTraceTime, 8) * fastAllocationRate;
+
+    EXPECT_LT(slowThreshold, fastThreshold);
+    EXPECT_LT(fastThreshold, taxedThreshold);
+}
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "CopyScanCacheDeque.hpp"
+#include "gcTestHelpers.hpp"
+
+#include "AtomicOperations.hpp"
+
+#include <gtest/gtest.h>
+
+#define THIEF_COUNT 3
+#define TOKEN_COUNT 20000
+#define BATCH_SIZE 64
+
+/* the deque only moves pointers, so entries can stand in for caches */
+struct DequeEntry {
+    volatile uintptr_t takenCount;
+};
+
+struct DequeStealData {
+    MM_CopyScanCacheDeque *deque;
+    volatile uintptr_t stolenCount;
+    volatile bool ownerDone;
+};
+
+static MM_CopyScanCacheStandard *
+toCache(DequeEntry *entry)
+{
+    return (MM_CopyScanCacheStandard *)entry;
+}
+
+static void
+take(MM_CopyScanCacheStandard *cache)
+{
+    MM_AtomicOperations::add(&((DequeEntry *)cache)->takenCount, 1);
+}
+
+static int J9THREAD_PROC
+thiefMain(void *arg)
+{
+    DequeStealData *data = (DequeStealData *)arg;
+    while (!data->ownerDone) {
+        MM_CopyScanCacheStandard *cache = data->deque->steal();
+        if (NULL != cache) {
+            take(cache);
+            MM_AtomicOperations::add(&data->stolenCount, 1);
+        } else {
+            omrthread_yield();
+        }
+    }
+    return 0;
+}
+
+TEST(TestCopyScanCacheDeque, OwnerPopsNewestAndThievesStealOldest)
+{
+    MM_CopyScanCacheDeque deque;
+    DequeEntry entries[MM_CopyScanCacheDeque::CAPACITY + 1];
+    deque.reset(1);
+
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_TRUE(NULL == deque.pop());
+    EXPECT_TRUE(NULL == deque.steal());
+
+    for (uintptr_t index = 0; index < 4; index++) {
+        EXPECT_TRUE(deque.push(toCache(&entries[index])));
+    }
+    EXPECT_EQ(deque.getApproximateEntryCount(), 4u);
+    EXPECT_EQ(deque.pop(), toCache(&entries[3]));
+    EXPECT_EQ(deque.steal(), toCache(&entries[0]));
+    EXPECT_EQ(deque.pop(), toCache(&entries[2]));
+    /* the owner wins the race for the last entry when nobody steals it */
+    EXPECT_EQ(deque.pop(), toCache(&entries[1]));
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_TRUE(NULL == deque.pop());
+
+    /* a full deque refuses the push, the caller falls back to the shared scan list */
+    for (uintptr_t index = 0; index < MM_CopyScanCacheDeque::CAPACITY; index++) {
+        EXPECT_TRUE(deque.push(toCache(&entries[index])));
+    }
+    EXPECT_FALSE(deque.push(toCache(&entries[MM_CopyScanCacheDeque::CAPACITY])));
+    EXPECT_EQ(deque.steal(), toCache(&entries[0]));
+    EXPECT_TRUE(deque.push(toCache(&entries[MM_CopyScanCacheDeque::CAPACITY])));
+    EXPECT_EQ(deque.pop(), toCache(&entries[MM_CopyScanCacheDeque::CAPACITY]));
+}
+
+TEST(TestCopyScanCacheDeque, ConcurrentStealsTakeEveryEntryOnce)
+{
+    volatile uintptr_t nonEmptyCount = 0;
+    MM_CopyScanCacheDeque deque;
+    deque.setNonEmptyCount(&nonEmptyCount);
+    deque.reset(1);
+
+    DequeEntry *entries = new DequeEntry[TOKEN_COUNT];
+    for (uintptr_t index = 0; index < TOKEN_COUNT; index++) {
+        entries[index].takenCount = 0;
+    }
+
+    DequeStealData data;
+    data.deque = &deque;
+    data.stolenCount = 0;
+    data.ownerDone = false;
+
+    omrthread_t thieves[THIEF_COUNT];
+    for (uintptr_t thief = 0; thief < THIEF_COUNT; thief++) {
+        omrthread_attr_t attr = NULL;
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&thieves[thief], &attr, 0, thiefMain, &data));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+    }
+
+    /* the owner lets the thieves take part of each batch, then pops the rest racing them for the last entries.
+     * Every other batch, and the last one, is left to the thieves entirely, so they race the next push for the count.
+     */
+    for (uintptr_t base = 0; base < TOKEN_COUNT; base += BATCH_SIZE) {
+        bool lastBatch = ((base + BATCH_SIZE) >= TOKEN_COUNT);
+        for (uintptr_t index = base; (index < TOKEN_COUNT) && (index < (base + BATCH_SIZE)); index++) {
+            EXPECT_TRUE(deque.push(toCache(&entries[index])));
+        }
+        if (lastBatch || (0 != ((base / BATCH_SIZE) % 2))) {
+            while (!deque.isEmpty()) {
+                omrthread_yield();
+            }
+        } else {
+            while (deque.getApproximateEntryCount() > (BATCH_SIZE / 2)) {
+                omrthread_yield();
+            }
+            MM_CopyScanCacheStandard *cache = NULL;
+            while (NULL != (cache = deque.pop())) {
+                take(cache);
+            }
+        }
+    }
+
+    data.ownerDone = true;
+    for (uintptr_t thief = 0; thief < THIEF_COUNT; thief++) {
+        EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(thieves[thief]));
+    }
+
+    /* the thieves emptied the deque last, without the owner looking at it again */
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_EQ(nonEmptyCount, 0u);
+
+    uintptr_t lost = 0;
+    uintptr_t duplicated = 0;
+    for (uintptr_t index = 0; index < TOKEN_COUNT; index++) {
+        if (0 == entries[index].takenCount) {
+            lost += 1;
+        } else if (1 < entries[index].takenCount) {
+            duplicated += 1;
+        }
+    }
+    EXPECT_GT(data.stolenCount, 0u);
+    EXPECT_EQ(lost, 0u);
+    EXPECT_EQ(duplicated, 0u);
+
+    delete[] entries;
+}
+
+TEST(TestCopyScanCacheDeque, NonEmptyCountCoversEveryNonEmptyDeque)
+{
+    volatile uintptr_t nonEmptyCount = 0;
+    MM_CopyScanCacheDeque deques[2];
+    DequeEntry entries[3];
+    for (uintptr_t index = 0; index < 2; index++) {
+        deques[index].setNonEmptyCount(&nonEmptyCount);
+        deques[index].reset(1);
+    }
+
+    /* the first push counts a deque, further pushes do not */
+    EXPECT_TRUE(deques[0].push(toCache(&entries[0])));
+    EXPECT_TRUE(deques[0].push(toCache(&entries[1])));
+    EXPECT_EQ(nonEmptyCount, 1u);
+    EXPECT_TRUE(deques[1].push(toCache(&entries[2])));
+    EXPECT_EQ(nonEmptyCount, 2u);
+
+    /* a thief taking the last entry drops the deque from the count without waiting for its owner */
+    EXPECT_EQ(deques[1].steal(), toCache(&entries[2]));
+    EXPECT_EQ(nonEmptyCount, 1u);
+    EXPECT_TRUE(NULL == deques[1].pop());
+    EXPECT_EQ(nonEmptyCount, 1u);
+
+    /* the owner pushing again counts the deque again */
+    EXPECT_TRUE(deques[1].push(toCache(&entries[2])));
+    EXPECT_EQ(nonEmptyCount, 2u);
+    EXPECT_EQ(deques[1].steal(), toCache(&entries[2]));
+    EXPECT_EQ(nonEmptyCount, 1u);
+
+    /* the owner taking the last entry drops the deque from the count */
+    EXPECT_EQ(deques[0].pop(), toCache(&entries[1]));
+    EXPECT_EQ(nonEmptyCount, 1u);
+    EXPECT_EQ(deques[0].pop(), toCache(&entries[0]));
+    EXPECT_EQ(nonEmptyCount, 0u);
+    EXPECT_TRUE(NULL == deques[0].pop());
+    EXPECT_EQ(nonEmptyCount, 0u);
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapResizeStats.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestHeapResizeStats, PredictsFreeBytesForGCPercentage)
+{
+    uintptr_t megabyte = 1024 * 1024;
+
+    MM_HeapResizeStats stats;
+    EXPECT_FALSE(stats.isGCCostModelValid());
+    EXPECT_EQ(stats.predictFreeBytesForGCPercentage(5), 0u);
+
+    /* collections of unknown cost or that free nothing are not measurements */
+    stats.updateGCCostModel(0, 16 * megabyte);
+    stats.updateGCCostModel(10, 0);
+    EXPECT_FALSE(stats.isGCCostModelValid());
+
+    /* 10% of time in GC with 16MB free: halving the GC time needs twice the free memory */
+    stats.updateGCCostModel(10, 16 * megabyte);
+    ASSERT_TRUE(stats.isGCCostModelValid());
+    EXPECT_EQ(stats.predictFreeBytesForGCPercentage(5), 32 * megabyte);
+    EXPECT_EQ(stats.predictFreeBytesForGCPercentage(20), 8 * megabyte);
+
+    /* a cheaper collection at the same free memory lowers the prediction */
+    stats.updateGCCostModel(2, 16 * megabyte);
+    EXPECT_LT(stats.predictFreeBytesForGCPercentage(5), 32 * megabyte);
+
+    stats.resetGCCostModel();
+    EXPECT_FALSE(stats.isGCCostModelValid());
+}
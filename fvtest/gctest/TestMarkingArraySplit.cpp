@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "omrmodroncore.h"
+#include "GCExtensionsBase.hpp"
+#include "IndexableObjectScanner.hpp"
+#include "MarkingScheme.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "SlotObject.hpp"
+#include "Task.hpp"
+#include "WorkStack.hpp"
+
+#include <gtest/gtest.h>
+
+#define ARRAY_LENGTH 1000
+#define SPLIT_THRESHOLD 64
+#define SPLIT_AMOUNT 128
+
+class TestMarkingArraySplit : public GCHeapTest
+{
+};
+
+/**
+ * Scanner for an array whose elements are single reference slots. Its slot maps are derived from the scan and
+ * end pointers, as GC_IndexableObjectScanner::restrictToRange() requires.
+ */
+class TestReferenceArrayScanner : public GC_IndexableObjectScanner
+{
+private:
+    fomrobject_t *
+    nextSlotMap(uintptr_t *scanMap, bool *hasNextSlotMap)
+    {
+        intptr_t remaining = GC_SlotObject::subtractSlotAddresses(_endPtr, _scanPtr, compressObjectReferences());
+        if (0 >= remaining) {
+            *scanMap = 0;
+            *hasNextSlotMap = false;
+            return NULL;
+        }
+        *scanMap = (remaining < _bitsPerScanMap) ? (((uintptr_t)1 << remaining) - 1) : UDATA_MAX;
+        *hasNextSlotMap = (remaining > _bitsPerScanMap);
+        return _scanPtr;
+    }
+
+protected:
+    virtual fomrobject_t *
+    getNextSlotMap(uintptr_t *scanMap, bool *hasNextSlotMap)
+    {
+        return nextSlotMap(scanMap, hasNextSlotMap);
+    }
+
+#if defined(OMR_GC_LEAF_BITS)
+    virtual fomrobject_t *
+    getNextSlotMap(uintptr_t *scanMap, uintptr_t *leafMap, bool *hasNextSlotMap)
+    {
+        *leafMap = 0;
+        return nextSlotMap(scanMap, hasNextSlotMap);
+    }
+#endif /* OMR_GC_LEAF_BITS */
+
+public:
+    TestReferenceArrayScanner(MM_EnvironmentBase *env, omrobjectptr_t arrayPtr, fomrobject_t *basePtr, uintptr_t length)
+        : GC_IndexableObjectScanner(env, arrayPtr, basePtr
+            , GC_SlotObject::addToSlotAddress(basePtr, (intptr_t)length, env->compressObjectReferences())
+            , basePtr
+            , GC_SlotObject::addToSlotAddress(basePtr, (intptr_t)length, env->compressObjectReferences())
+            , (length < (uintptr_t)_bitsPerScanMap) ? (((uintptr_t)1 << length) - 1) : UDATA_MAX
+            , env->compressObjectReferences() ? sizeof(uint32_t) : sizeof(uintptr_t)
+            , 0)
+    {
+        initialize(env);
+    }
+};
+
+/**
+ * Stands in for the marking task, splitIndexableObject() sizes the ranges by the task's thread count.
+ */
+class TestMarkTask : public MM_Task
+{
+public:
+    virtual void run(MM_EnvironmentBase *env) { }
+    virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; }
+
+    TestMarkTask(MM_EnvironmentBase *env)
+        : MM_Task(env, env->getExtensions()->dispatcher)
+    {
+    }
+};
+
+TEST_F(TestMarkingArraySplit, SplitRangesCoverEveryElementOnce)
+{
+    MM_GCExtensionsBase *extensions = env->getExtensions();
+    MM_MarkingScheme *markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+    bool const compressed = env->compressObjectReferences();
+
+    /* every element holds a distinct non-NULL value, so the scanner reports each one as a slot */
+    static uintptr_t arraySpace[ARRAY_LENGTH];
+    fomrobject_t *basePtr = (fomrobject_t *)arraySpace;
+    for (uintptr_t index = 0; index < ARRAY_LENGTH; index++) {
+        GC_SlotObject slotObject(env->getOmrVM(), GC_SlotObject::addToSlotAddress(basePtr, (intptr_t)index, compressed));
+        slotObject.writeReferenceToSlot((omrobjectptr_t)((index + 1) << 4));
+    }
+    omrobjectptr_t arrayPtr = (omrobjectptr_t)arraySpace;
+
+    uintptr_t threshold = extensions->markingArraySplitThreshold;
+    uintptr_t minimumAmount = extensions->markingArraySplitMinimumAmount;
+    uintptr_t maximumAmount = extensions->markingArraySplitMaximumAmount;
+    extensions->markingArraySplitThreshold = SPLIT_THRESHOLD;
+    extensions->markingArraySplitMinimumAmount = SPLIT_AMOUNT;
+    extensions->markingArraySplitMaximumAmount = SPLIT_AMOUNT;
+
+    TestMarkTask task(env);
+    env->_currentTask = &task;
+    markingScheme->mainSetupForGC(env);
+    markingScheme->workerSetupForGC(env);
+
+    uint8_t visits[ARRAY_LENGTH];
+    memset(visits, 0, sizeof(visits));
+    uintptr_t ranges = 0;
+    uintptr_t bytesToDo = 0;
+
+    /* replay what completeScan() and scanObject() do: pop the array, split it and scan the range it was restricted to */
+    env->_workStack.push(env, (void *)arrayPtr);
+    env->_workStack.flushOutputPacket(env);
+    omrobjectptr_t objectPtr = NULL;
+    while (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+        ASSERT_EQ(arrayPtr, objectPtr);
+        ASSERT_LT(ranges, (uintptr_t)ARRAY_LENGTH);
+        TestReferenceArrayScanner scanner(env, arrayPtr, basePtr, ARRAY_LENGTH);
+        bytesToDo += markingScheme->splitIndexableObject(env, &scanner);
+        ranges += 1;
+
+        GC_SlotObject *slotObject = NULL;
+        while (NULL != (slotObject = scanner.getNextSlot())) {
+            uintptr_t index = (uintptr_t)GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), basePtr, compressed);
+            ASSERT_LT(index, (uintptr_t)ARRAY_LENGTH);
+            EXPECT_EQ((uintptr_t)((index + 1) << 4), (uintptr_t)slotObject->readReferenceFromSlot());
+            visits[index] += 1;
+        }
+        /* the tail is pushed to the output packet, publish it as the next input as another thread would see it */
+        env->_workStack.flushOutputPacket(env);
+    }
+
+    env->_workStack.flush(env);
+    env->_currentTask = NULL;
+    extensions->markingArraySplitThreshold = threshold;
+    extensions->markingArraySplitMinimumAmount = minimumAmount;
+    extensions->markingArraySplitMaximumAmount = maximumAmount;
+
+    for (uintptr_t index = 0; index < ARRAY_LENGTH; index++) {
+        EXPECT_EQ(1, visits[index]) << "element " << index;
+    }
+    /* ranges of SPLIT_AMOUNT elements, the last range takes the rest once it is no larger than a split */
+    EXPECT_EQ((uintptr_t)((ARRAY_LENGTH + SPLIT_AMOUNT - 1) / SPLIT_AMOUNT), ranges);
+    EXPECT_EQ((uintptr_t)ARRAY_LENGTH * (compressed ? sizeof(uint32_t) : sizeof(uintptr_t)), bytesToDo);
+}
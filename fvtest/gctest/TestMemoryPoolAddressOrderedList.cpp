@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "AllocateDescription.hpp"
+#include "GCExtensionsBase.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+
+#include <gtest/gtest.h>
+
+#define KB ((uintptr_t)1024)
+#define BUFFER_SIZE (192 * KB)
+
+class TestMemoryPoolAddressOrderedList : public GCHeapTest
+{
+protected:
+    uint8_t *buffer;
+    MM_MemoryPoolAddressOrderedList *pool;
+
+    virtual void SetUp()
+    {
+        GCHeapTest::SetUp();
+        OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+        buffer = (uint8_t *)omrmem_allocate_memory(BUFFER_SIZE, OMRMEM_CATEGORY_MM);
+        ASSERT_TRUE(NULL != buffer);
+        pool = MM_MemoryPoolAddressOrderedList::newInstance(env, env->getExtensions()->getMinimumFreeEntrySize(), "Test");
+        ASSERT_TRUE(NULL != pool);
+        pool->setSubSpace(env->getDefaultMemorySubSpace());
+    }
+
+    virtual void TearDown()
+    {
+        OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+        if (NULL != pool) {
+            pool->kill(env);
+        }
+        omrmem_free_memory(buffer);
+        GCHeapTest::TearDown();
+    }
+
+    void addFreeRange(uintptr_t lowOffset, uintptr_t highOffset, bool canCoalesce)
+    {
+        pool->expandWithRange(env, highOffset - lowOffset, buffer + lowOffset, buffer + highOffset, canCoalesce);
+    }
+
+    void *allocate(uintptr_t size)
+    {
+        MM_AllocateDescription allocDescription(size, 0, false, true);
+        return pool->allocateObject(env, &allocDescription);
+    }
+};
+
+TEST_F(TestMemoryPoolAddressOrderedList, SizeClassIndexSurvivesSplitCoalesceAndRebuild)
+{
+    /* rebuild: free entries of 1K, 2K, 4K, 16K, 8K and 84K separated by 1K of live memory */
+    pool->reset();
+    addFreeRange(0, 1 * KB, false);
+    addFreeRange(2 * KB, 4 * KB, false);
+    addFreeRange(5 * KB, 9 * KB, false);
+    addFreeRange(10 * KB, 26 * KB, false);
+    addFreeRange(27 * KB, 35 * KB, false);
+    addFreeRange(36 * KB, 120 * KB, false);
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+
+    /* split: each walk records where the entries too small for its size class end */
+    EXPECT_TRUE(NULL != allocate(3 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    EXPECT_TRUE(NULL != allocate(12 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    EXPECT_TRUE(NULL != allocate(6 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    EXPECT_TRUE(NULL != allocate(2 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+
+    /* nothing is large enough, so the size class is marked as exhausted */
+    EXPECT_TRUE(NULL == allocate(130 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+
+    /* coalesce: growing the last entry past 128K must make the exhausted size class reachable again */
+    addFreeRange(120 * KB, BUFFER_SIZE, true);
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    EXPECT_TRUE(NULL != allocate(130 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+
+    /* rebuild after a reset, as a sweep does, with an index built against the old list */
+    EXPECT_TRUE(NULL == allocate(64 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    pool->reset();
+    addFreeRange(0, 8 * KB, false);
+    addFreeRange(9 * KB, BUFFER_SIZE, false);
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+    EXPECT_TRUE(NULL != allocate(64 * KB));
+    EXPECT_TRUE(pool->isValidSizeClassIndex());
+}
+
+TEST_F(TestMemoryPoolAddressOrderedList, FreeListWalksAreRecorded)
+{
+    MM_LargeObjectAllocateStats *stats = pool->getLargeObjectAllocateStats();
+    ASSERT_TRUE(NULL != stats);
+
+    /* free entries of 1K, 2K and 4K ahead of a 64K entry */
+    pool->reset();
+    addFreeRange(0, 1 * KB, false);
+    addFreeRange(2 * KB, 4 * KB, false);
+    addFreeRange(5 * KB, 9 * KB, false);
+    addFreeRange(10 * KB, 74 * KB, false);
+    pool->resetLargeObjectAllocateStats();
+    EXPECT_EQ((uintptr_t)0, stats->getFreeListSearchCount());
+
+    /* the first entry fits, nothing is walked past */
+    EXPECT_TRUE(NULL != allocate(512));
+    EXPECT_EQ((uintptr_t)1, stats->getFreeListSearchCount());
+    EXPECT_EQ((uintptr_t)0, stats->getFreeListWalkLength());
+
+    /* every search is counted, whether it succeeds or fails, and no walk is longer than the list */
+    EXPECT_TRUE(NULL != allocate(32 * KB));
+    EXPECT_TRUE(NULL == allocate(128 * KB));
+    EXPECT_EQ((uintptr_t)3, stats->getFreeListSearchCount());
+    EXPECT_LE(stats->getFreeListWalkLengthMax(), stats->getFreeListWalkLength());
+    EXPECT_LE(stats->getFreeListWalkLengthMax(), (uintptr_t)4);
+
+    /* a sweep starts a new count */
+    pool->resetLargeObjectAllocateStats();
+    EXPECT_EQ((uintptr_t)0, stats->getFreeListSearchCount());
+    EXPECT_EQ((uintptr_t)0, stats->getFreeListWalkLength());
+    EXPECT_EQ((uintptr_t)0, stats->getFreeListWalkLengthMax());
+}
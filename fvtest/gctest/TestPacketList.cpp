@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "Packet.hpp"
+#include "PacketList.hpp"
+
+#include <gtest/gtest.h>
+
+#define PACKET_COUNT 10
+
+class TestPacketList : public GCHeapTest
+{
+};
+
+TEST_F(TestPacketList, RemoveReturnedUnlinksOnlyReturnedPackets)
+{
+    MM_PacketList inUseList(env);
+    MM_PacketList fullList(env);
+    ASSERT_TRUE(inUseList.initialize(env));
+    ASSERT_TRUE(fullList.initialize(env));
+
+    MM_Packet packets[PACKET_COUNT];
+    for (uintptr_t index = 0; index < PACKET_COUNT; index++) {
+        packets[index].setOwner(env);
+        EXPECT_FALSE(packets[index].isReturned());
+        inUseList.push(env, &packets[index]);
+    }
+
+    MM_Packet *head = NULL;
+    MM_Packet *tail = NULL;
+    EXPECT_EQ(inUseList.removeReturned(&head, &tail), (uintptr_t)0);
+    EXPECT_TRUE(NULL == head);
+    EXPECT_TRUE(NULL == tail);
+
+    /* retire every other packet, as a fragment refresh does with a full barrier packet */
+    for (uintptr_t index = 0; index < PACKET_COUNT; index += 2) {
+        packets[index].resetOwner();
+        EXPECT_TRUE(packets[index].isReturned());
+    }
+
+    uintptr_t removed = inUseList.removeReturned(&head, &tail);
+    EXPECT_EQ(removed, (uintptr_t)(PACKET_COUNT / 2));
+    EXPECT_EQ(inUseList.getCount(), (uintptr_t)(PACKET_COUNT / 2));
+
+    /* the chain is doubly linked and holds only returned packets */
+    uintptr_t chained = 0;
+    MM_Packet *previous = NULL;
+    for (MM_Packet *packet = head; NULL != packet; packet = packet->_next) {
+        EXPECT_TRUE(packet->isReturned());
+        EXPECT_EQ(packet->_previous, previous);
+        previous = packet;
+        chained += 1;
+    }
+    EXPECT_EQ(chained, removed);
+    EXPECT_EQ(previous, tail);
+
+    /* publishing the chain in one push makes every packet available to a popper */
+    fullList.pushList(head, tail, removed);
+    EXPECT_EQ(fullList.getCount(), removed);
+
+    uintptr_t popped = 0;
+    MM_Packet *packet = NULL;
+    while (NULL != (packet = fullList.pop(env))) {
+        EXPECT_TRUE(packet->isReturned());
+        popped += 1;
+    }
+    EXPECT_EQ(popped, removed);
+
+    /* packets still owned stay on the in use list */
+    popped = 0;
+    while (NULL != (packet = inUseList.pop(env))) {
+        EXPECT_FALSE(packet->isReturned());
+        popped += 1;
+    }
+    EXPECT_EQ(popped, (uintptr_t)(PACKET_COUNT / 2));
+    EXPECT_EQ(inUseList.removeReturned(&head, &tail), (uintptr_t)0);
+
+    fullList.tearDown(env);
+    inUseList.tearDown(env);
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "PacketStack.hpp"
+#include "gcTestHelpers.hpp"
+
+#include "AtomicOperations.hpp"
+
+#include <gtest/gtest.h>
+
+#define PACKET_COUNT 16
+#define WORKER_COUNT 4
+#define ITERATION_COUNT 100000
+
+struct PacketStackData {
+    MM_PacketStack *stack;
+    volatile uintptr_t held[PACKET_COUNT]; /**< number of workers holding each packet, never above 1 */
+    volatile uintptr_t duplicated;
+    volatile uintptr_t popped;
+};
+
+static bool
+hold(PacketStackData *data, MM_Packet *packet)
+{
+    uintptr_t index = packet->getPacketIndex() - 1;
+    return 0 == MM_AtomicOperations::lockCompareExchange(&data->held[index], 0, 1);
+}
+
+static void
+release(PacketStackData *data, MM_Packet *packet)
+{
+    data->held[packet->getPacketIndex() - 1] = 0;
+    MM_AtomicOperations::writeBarrier();
+}
+
+static int J9THREAD_PROC
+workerMain(void *arg)
+{
+    PacketStackData *data = (PacketStackData *)arg;
+    for (uintptr_t iteration = 0; iteration < ITERATION_COUNT; iteration++) {
+        MM_Packet *first = data->stack->pop(NULL);
+        if (NULL == first) {
+            omrthread_yield();
+            continue;
+        }
+        MM_AtomicOperations::add(&data->popped, 1);
+        if (!hold(data, first)) {
+            MM_AtomicOperations::add(&data->duplicated, 1);
+        }
+        /* every other round returns two packets as one chain, as a thread flushing its packet cache does */
+        MM_Packet *second = (0 == (iteration % 2)) ? data->stack->pop(NULL) : NULL;
+        if (NULL != second) {
+            MM_AtomicOperations::add(&data->popped, 1);
+            if (!hold(data, second)) {
+                MM_AtomicOperations::add(&data->duplicated, 1);
+            }
+            release(data, second);
+            release(data, first);
+            first->_next = second;
+            data->stack->pushList(first, second, 2);
+        } else {
+            release(data, first);
+            data->stack->push(NULL, first);
+        }
+    }
+    return 0;
+}
+
+class TestPacketStack : public ::testing::Test
+{
+protected:
+    MM_Packet packets[PACKET_COUNT];
+    MM_Packet *packetTable[PACKET_COUNT];
+    MM_PacketStack stack;
+
+    virtual void
+    SetUp()
+    {
+        for (uintptr_t index = 0; index < PACKET_COUNT; index++) {
+            packets[index].setPacketIndex(index + 1);
+            packetTable[index] = &packets[index];
+        }
+        ASSERT_TRUE(stack.initialize(NULL, packetTable));
+    }
+};
+
+TEST_F(TestPacketStack, PopReturnsLastPushedFirst)
+{
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_TRUE(NULL == stack.pop(NULL));
+
+    stack.push(NULL, &packets[0]);
+    stack.push(NULL, &packets[1]);
+    EXPECT_FALSE(stack.isEmpty());
+    EXPECT_EQ(stack.getCount(), 2u);
+
+    /* a chain goes on top in its own order */
+    packets[2]._next = &packets[3];
+    stack.pushList(&packets[2], &packets[3], 2);
+    EXPECT_EQ(stack.getCount(), 4u);
+
+    EXPECT_EQ(stack.pop(NULL), &packets[2]);
+    EXPECT_EQ(stack.pop(NULL), &packets[3]);
+    EXPECT_EQ(stack.pop(NULL), &packets[1]);
+    EXPECT_EQ(stack.pop(NULL), &packets[0]);
+    EXPECT_TRUE(NULL == stack.pop(NULL));
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_EQ(stack.getCount(), 0u);
+}
+
+TEST_F(TestPacketStack, ConcurrentPushesAndPopsKeepEveryPacketOnce)
+{
+    for (uintptr_t index = 0; index < PACKET_COUNT; index++) {
+        stack.push(NULL, &packets[index]);
+    }
+
+    PacketStackData data;
+    data.stack = &stack;
+    for (uintptr_t index = 0; index < PACKET_COUNT; index++) {
+        data.held[index] = 0;
+    }
+    data.duplicated = 0;
+    data.popped = 0;
+
+    omrthread_t workers[WORKER_COUNT];
+    for (uintptr_t worker = 0; worker < WORKER_COUNT; worker++) {
+        omrthread_attr_t attr = NULL;
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&workers[worker], &attr, 0, workerMain, &data));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+    }
+    for (uintptr_t worker = 0; worker < WORKER_COUNT; worker++) {
+        EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(workers[worker]));
+    }
+
+    EXPECT_GT(data.popped, 0u);
+    EXPECT_EQ(data.duplicated, 0u);
+    EXPECT_EQ(stack.getCount(), (uintptr_t)PACKET_COUNT);
+
+    /* every packet made it back exactly once */
+    uintptr_t seen[PACKET_COUNT] = {0};
+    uintptr_t popped = 0;
+    MM_Packet *packet = NULL;
+    while (NULL != (packet = stack.pop(NULL))) {
+        seen[packet->getPacketIndex() - 1] += 1;
+        popped += 1;
+        ASSERT_LE(popped, (uintptr_t)PACKET_COUNT);
+    }
+    for (uintptr_t index = 0; index < PACKET_COUNT; index++) {
+        EXPECT_EQ(seen[index], 1u);
+    }
+    EXPECT_EQ(stack.getCount(), 0u);
+}
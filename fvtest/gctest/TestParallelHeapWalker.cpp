@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "omrgc.h"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+
+#include <gtest/gtest.h>
+
+#define OBJECT_COUNT 512
+#define OBJECT_SIZE 128
+
+class TestParallelHeapWalker : public GCHeapTest
+{
+};
+
+struct ObjectTally {
+    uintptr_t count;
+    uintptr_t bytes;
+};
+
+static void
+tallyObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+    MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+    ObjectTally *tally = (ObjectTally *)userData;
+    tally->count += 1;
+    tally->bytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+
+static void
+accumulateObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData, void *accumulator)
+{
+    /* every worker writes only its own accumulator, which must not share a cache line with another worker's */
+    EXPECT_EQ((uintptr_t)accumulator % CACHE_LINE_SIZE, (uintptr_t)0);
+    tallyObject(omrVMThread, region, object, accumulator);
+}
+
+static void
+mergeTally(OMR_VMThread *omrVMThread, void *userData, void *accumulator)
+{
+    ObjectTally *result = (ObjectTally *)userData;
+    ObjectTally *tally = (ObjectTally *)accumulator;
+    result->count += tally->count;
+    result->bytes += tally->bytes;
+}
+
+TEST_F(TestParallelHeapWalker, AccumulateMatchesSerialWalk)
+{
+    /* root every other object; the parallel walk chunks regions at marked objects, so it needs a collection first */
+    static char rootNames[OBJECT_COUNT / 2][16];
+    for (uintptr_t index = 0; index < OBJECT_COUNT; index++) {
+        uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+        MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+                MM_ObjectAllocationModel(env, OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+        omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+        ASSERT_TRUE(NULL != object);
+        if (0 == (index % 2)) {
+            RootEntry rootEntry;
+            snprintf(rootNames[index / 2], sizeof(rootNames[0]), "root%zu", (size_t)(index / 2));
+            rootEntry.name = rootNames[index / 2];
+            rootEntry.rootPtr = object;
+            ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+        }
+    }
+    ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+
+    MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+    MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+
+    ObjectTally accumulated = {0, 0};
+    ASSERT_TRUE(heapWalker->allObjectsDoAccumulate(env, accumulateObject, mergeTally, &accumulated, sizeof(ObjectTally), MEMORY_TYPE_RAM, true));
+
+    ObjectTally serial = {0, 0};
+    heapWalker->allObjectsDo(env, tallyObject, &serial, MEMORY_TYPE_RAM, false, true);
+
+    EXPECT_GE(serial.count, (uintptr_t)(OBJECT_COUNT / 2));
+    EXPECT_EQ(accumulated.count, serial.count);
+    EXPECT_EQ(accumulated.bytes, serial.bytes);
+}
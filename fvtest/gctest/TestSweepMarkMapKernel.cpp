@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "SweepMarkMapKernel.hpp"
+
+#include <gtest/gtest.h>
+
+#define MARK_MAP_WORDS 203
+
+class TestSweepMarkMapKernel : public GCHeapTest
+{
+protected:
+    /**
+     * Check both scan functions of two kernels agree for every start word and every end word of markMap.
+     */
+    void expectKernelsAgree(MM_SweepMarkMapKernel *expected, MM_SweepMarkMapKernel *actual, uintptr_t *markMap)
+    {
+        for (uintptr_t start = 0; start <= MARK_MAP_WORDS; start++) {
+            for (uintptr_t top = start; top <= MARK_MAP_WORDS; top++) {
+                ASSERT_EQ(expected->_findMarkedWord(markMap + start, markMap + top), actual->_findMarkedWord(markMap + start, markMap + top))
+                        << "findMarkedWord [" << start << ", " << top << ")";
+                ASSERT_EQ(expected->_findEmptyWord(markMap + start, markMap + top), actual->_findEmptyWord(markMap + start, markMap + top))
+                        << "findEmptyWord [" << start << ", " << top << ")";
+            }
+        }
+    }
+};
+
+TEST_F(TestSweepMarkMapKernel, VectorKernelMatchesPortableKernel)
+{
+    MM_SweepMarkMapKernel portable;
+    portable.initialize(env, false);
+    MM_SweepMarkMapKernel vector;
+    vector.initialize(env, true);
+    if (vector._findMarkedWord == portable._findMarkedWord) {
+        gcTestEnv->log(LEVEL_WARN, "vector sweep kernel not supported here, checking the portable kernel against itself\n");
+    }
+
+    /* each pattern marks a word when the step hits it, from mostly free to mostly live mark maps */
+    uintptr_t markMap[MARK_MAP_WORDS];
+    uintptr_t const steps[] = {1, 2, 3, 7, 16, 61, MARK_MAP_WORDS};
+    for (uintptr_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        for (uintptr_t word = 0; word < MARK_MAP_WORDS; word++) {
+            markMap[word] = (0 == (word % steps[i])) ? ((uintptr_t)1 << (word % (sizeof(uintptr_t) * 8))) : 0;
+        }
+        expectKernelsAgree(&portable, &vector, markMap);
+        /* and the complement, so that runs of live words are as varied as runs of free words */
+        for (uintptr_t word = 0; word < MARK_MAP_WORDS; word++) {
+            markMap[word] = (0 == markMap[word]) ? UDATA_MAX : 0;
+        }
+        expectKernelsAgree(&portable, &vector, markMap);
+    }
+}
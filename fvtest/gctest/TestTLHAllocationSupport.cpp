@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCHeapTest.hpp"
+
+#include "AllocationStats.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationInterface.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+
+#include <gtest/gtest.h>
+
+#define KB ((uintptr_t)1024)
+
+class TestTLHAllocationSupport : public GCHeapTest
+{
+protected:
+    /**
+     * Start from an empty heap and a thread whose TLH is back at its initial size, then allocate bytes worth of
+     * small objects without collecting.
+     * @param[out] requestedBytes the bytes asked for by those refreshes
+     * @return the number of TLH refreshes the allocations took
+     */
+    uintptr_t refreshesToAllocate(uintptr_t bytes, uintptr_t objectSize, uintptr_t *requestedBytes)
+    {
+        EXPECT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+
+        /* the collection flushed the TLH; restarting repeatedly halves the refresh size down to the initial size */
+        MM_ObjectAllocationInterface *allocationInterface = env->_objectAllocationInterface;
+        allocationInterface->flushCache(env);
+        for (uintptr_t i = 0; i < 16; i++) {
+            allocationInterface->restartCache(env);
+        }
+
+        MM_AllocationStats *stats = allocationInterface->getAllocationStats();
+        uintptr_t refreshesBefore = stats->_tlhRefreshCountFresh + stats->_tlhRefreshCountReused;
+        uintptr_t requestedBytesBefore = stats->_tlhRequestedBytes;
+        uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+        for (uintptr_t allocated = 0; allocated < bytes; allocated += objectSize) {
+            MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+                    MM_ObjectAllocationModel(env, objectSize, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+            if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc)) {
+                ADD_FAILURE() << "heap exhausted after " << allocated << " bytes";
+                break;
+            }
+        }
+        *requestedBytes = stats->_tlhRequestedBytes - requestedBytesBefore;
+        return stats->_tlhRefreshCountFresh + stats->_tlhRefreshCountReused - refreshesBefore;
+    }
+};
+
+TEST_F(TestTLHAllocationSupport, AdaptiveSizingRefreshesASteadyAllocatorLessOften)
+{
+    MM_GCExtensionsBase *extensions = env->getExtensions();
+    bool adaptiveSizing = extensions->tlhAdaptiveSizing;
+
+    /* fixed increments grow each refresh by tlhIncrementSize, the decayed average grows it by half */
+    uintptr_t fixedRequestedBytes = 0;
+    extensions->tlhAdaptiveSizing = false;
+    uintptr_t fixedRefreshes = refreshesToAllocate(896 * KB, 64, &fixedRequestedBytes);
+    uintptr_t adaptiveRequestedBytes = 0;
+    extensions->tlhAdaptiveSizing = true;
+    uintptr_t adaptiveRefreshes = refreshesToAllocate(896 * KB, 64, &adaptiveRequestedBytes);
+    extensions->tlhAdaptiveSizing = adaptiveSizing;
+
+    ASSERT_LT((uintptr_t)0, fixedRefreshes);
+    ASSERT_LT((uintptr_t)0, adaptiveRefreshes);
+    EXPECT_LT(adaptiveRefreshes, fixedRefreshes);
+    EXPECT_LT(fixedRequestedBytes / fixedRefreshes, adaptiveRequestedBytes / adaptiveRefreshes);
+}
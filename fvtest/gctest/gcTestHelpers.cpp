@@ -34,6 +34,12 @@ GCTestEnvironment::initParams()
 	for (int i = 1; i < _argc; i++) {
 		if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-GCPolicy=", strlen("-GCPolicy="))) {
+			gcPolicyOverride = _argv[i] + strlen("-GCPolicy=");
+		} else if (0 == strncmp(_argv[i], "-memoryMax=", strlen("-memoryMax="))) {
+			memoryMaxOverride = (uintptr_t)atoi(_argv[i] + strlen("-memoryMax="));
+		} else if (0 == strncmp(_argv[i], "-gcthreadCount=", strlen("-gcthreadCount="))) {
+			gcThreadCountOverride = (uintptr_t)atoi(_argv[i] + strlen("-gcthreadCount="));
 		}
 	}
 }
@@ -43,6 +43,9 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	const char *gcPolicyOverride; /**< -GCPolicy=<policy> replaces the GCPolicy of every configuration */
+	uintptr_t memoryMaxOverride; /**< -memoryMax=<MB> fixes the heap of every configuration at this size */
+	uintptr_t gcThreadCountOverride; /**< -gcthreadCount=<n> replaces the gcthreadCount of every configuration */
 
 	/*
 	 * Function members
@@ -60,7 +63,7 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), gcPolicyOverride(NULL), memoryMaxOverride(0), gcThreadCountOverride(0)
 	{
 	}
 };
@@ -20,6 +20,7 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
 
 #include "omr.h"
 #include "omrutil.h"
@@ -54,3 +55,26 @@ TEST(UtilTest, detectVMDirectory)
 	}
 #endif /* defined(OMR_OS_WINDOWS) */
 }
+
+TEST(UtilTest, zeroMemoryNonTemporal)
+{
+	/* cover unaligned heads and tails, and lengths on both sides of the streaming cut-off */
+	const uintptr_t offsets[] = {0, 1, 15, 16, 33};
+	const uintptr_t lengths[] = {0, 1, 63, 255, 256, 257, 1000, 4096 + 7};
+	const uintptr_t guard = 64;
+	const uintptr_t bufferSize = 33 + 4096 + 7 + (2 * guard);
+	unsigned char buffer[bufferSize];
+
+	for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+		for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+			uintptr_t start = guard + offsets[o];
+			uintptr_t end = start + lengths[l];
+			memset(buffer, 0xA5, sizeof(buffer));
+			OMRZeroMemoryNonTemporal(buffer + start, lengths[l]);
+			for (uintptr_t i = 0; i < sizeof(buffer); i++) {
+				unsigned char expected = ((i >= start) && (i < end)) ? 0 : 0xA5;
+				ASSERT_EQ(expected, buffer[i]) << "offset " << offsets[o] << " length " << lengths[l] << " byte " << i;
+			}
+		}
+	}
+}
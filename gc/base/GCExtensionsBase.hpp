@@ -252,6 +252,8 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
+	bool concurrentSweepBackground; /**< if set, idle concurrent helper threads sweep chunks between global collections */
+	uintptr_t concurrentSweepBackgroundChunkBudget; /**< number of chunks a background sweeper processes before checking whether to yield */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	bool largePageWarnOnError;
@@ -326,6 +328,7 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< size each thread's next TLH from a decayed average of the bytes it consumed per TLH, instead of growing by tlhIncrementSize */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -336,6 +339,7 @@ public:
 	const char* gcModeString;
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
+	bool splitFreeListTryLock; /**< a thread whose affine split free list is locked by another thread moves on to the least contended split instead of waiting */
 	bool enableHybridMemoryPool;
 
 	bool largeObjectArea;
@@ -366,6 +370,7 @@ public:
 	float darkMatterCompactThreshold; /**< Value used to trigger compaction when dark matter ratio reaches this percentage of memory pools memory*/
 
 	uintptr_t parSweepChunkSize;
+	bool parSweepVectorKernel; /**< allow sweep to scan the mark map with a vector kernel when the processor supports it (false forces the portable kernel) */
 	uintptr_t heapExpansionMinimumSize;
 	uintptr_t heapExpansionMaximumSize;
 	uintptr_t heapFreeMinimumRatioDivisor;
@@ -376,6 +381,12 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	enum HeapResizePolicy {
+		HEAP_RESIZE_POLICY_FREE_RATIO = 0, /**< keep the memory free after a global GC between -Xminf and -Xmaxf */
+		HEAP_RESIZE_POLICY_GC_COST, /**< size the heap so the modelled time spent in GC meets heapResizeTargetGCPercentage */
+	};
+	HeapResizePolicy heapResizePolicy;
+	uintptr_t heapResizeTargetGCPercentage; /**< percentage of time spent in GC the cost model policy sizes the heap for */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -383,9 +394,11 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketsLockFree; /**< keep empty work packets on a lock-free stack and in small per-thread caches instead of the locked empty packet list */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingArraySplitThreshold; /**< reference arrays with more elements than this are scanned in ranges that idle marking threads can take over (0 to disable) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -435,6 +448,8 @@ public:
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	bool batchClearTLHNonTemporal; /**< batch clear fresh TLHs with non-temporal stores beyond the first batchClearTLHPrefetchWindow bytes */
+	uintptr_t batchClearTLHPrefetchWindow; /**< bytes at the start of a batch cleared TLH zeroed through the cache, and the distance allocation prefetches ahead of itself */
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
@@ -478,6 +493,9 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerScanCacheStealing; /**< if true, GC threads exchange scan caches through per-thread work-stealing deques and the shared scan list only takes overflow */
+	uintptr_t scavengerScanPrefetchDistance; /**< number of slots whose targets are prefetched ahead of copy and forward while scanning an object (0, the default, disables the prefetch pipeline) */
+	bool scavengerAdaptiveScanCacheSize; /**< if true, the upper bound for copy-scan cache sizes is tuned after each scavenge from the copy/scan ratio history and scan cache steal success rate */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -558,6 +576,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t compactIncrementSubAreaLimit; /**< Maximum number of sub areas evacuated by one non-aggressive compaction, the rest are only fixed up (0 evacuates the whole heap) */
+	bool compactForwardingSummary; /**< Keep an 8 byte per page forwarding summary so that compaction fixup walks fewer relocated objects per lookup */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -571,6 +591,7 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentPacing; /**< if true, kickoff is re-tuned from measured allocation and helper trace rates and from how the last cycle finished */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -632,6 +653,7 @@ public:
 	bool fixHeapForWalk; /**< configuration flag set by command line option or GC Check onload */
 	uintptr_t minArraySizeToSetAsScanned;
 	uintptr_t overflowCacheCount; /**< How many entries should there be in the environments local overflow cache */
+	uintptr_t satbPacketPublishBatchSize; /**< Number of full SATB barrier packets retired on the in use list before they are published to markers in one batch */
 #endif /* OMR_GC_REALTIME */
 
 #if defined(OMR_GC_REALTIME)
@@ -687,6 +709,7 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asynchronousLogging; /**< Enabled by -Xgc:asynchronousLogging.  Queue log output (e.g. verbose:gc) for a background thread to write to a file */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -830,6 +853,8 @@ public:
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
 	float gcOnIdleCompactThreshold; /**< Enables compaction when fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
+	bool idleHeapRelease; /**< Enables releasing free heap pages from a background thread once the heap has been idle for idleHeapReleaseIntervalMillis, default is false */
+	uintptr_t idleHeapReleaseIntervalMillis; /**< time without allocation or GC after which the heap is considered idle */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1395,6 +1420,8 @@ public:
 #endif /* OMR_GC_VLHGC */
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+		, concurrentSweepBackground(false)
+		, concurrentSweepBackgroundChunkBudget(4)
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
@@ -1452,6 +1479,7 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1460,6 +1488,7 @@ public:
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
+		, splitFreeListTryLock(false)
 		, enableHybridMemoryPool(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -1480,6 +1509,7 @@ public:
 		, absoluteMinimumNewSubSpaceSize(MINIMUM_NEW_SPACE_SIZE)
 		, darkMatterCompactThreshold((float)0.15)
 		, parSweepChunkSize(0)
+		, parSweepVectorKernel(true)
 		, heapExpansionMinimumSize(1024 * 1024)
 		, heapExpansionMaximumSize(0)
 		, heapFreeMinimumRatioDivisor(100)
@@ -1490,13 +1520,17 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapResizePolicy(HEAP_RESIZE_POLICY_FREE_RATIO)
+		, heapResizeTargetGCPercentage(5)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketsLockFree(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingArraySplitThreshold(0)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1538,6 +1572,8 @@ public:
 		, softMx(0) /* softMx only set if specified */
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 		, batchClearTLH(0)
+		, batchClearTLHNonTemporal(false)
+		, batchClearTLHPrefetchWindow(4096)
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
@@ -1573,6 +1609,9 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerScanCacheStealing(false)
+		, scavengerScanPrefetchDistance(0)
+		, scavengerAdaptiveScanCacheSize(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1638,6 +1677,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactIncrementSubAreaLimit(0)
+		, compactForwardingSummary(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1649,6 +1690,7 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentPacing(false)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1697,6 +1739,7 @@ public:
 		, fixHeapForWalk(false)
 		, minArraySizeToSetAsScanned(0)
 		, overflowCacheCount(0) /**< initial value of 0.  This is set in workpackets initialization or via the commandline */
+		, satbPacketPublishBatchSize(1)
 		, concurrentSweepingEnabled(false)
 		, concurrentTracingEnabled(false)
 #endif /* defined(OMR_GC_REALTIME) */
@@ -1735,6 +1778,7 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asynchronousLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1838,6 +1882,8 @@ public:
 		, gcOnIdle(false)
 		, compactOnIdle(false)
 		, gcOnIdleCompactThreshold((float)0.10)
+		, idleHeapRelease(false)
+		, idleHeapReleaseIntervalMillis(1000)
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_VALGRIND_MEMCHECK)
 		, valgrindMempoolAddr(0)
@@ -140,6 +140,48 @@ public:
 	 */
 	MMINLINE void scanToLimit() { _endPtr = _limitPtr; }
 
+	/**
+	 * Get the size of an array element in bytes.
+	 */
+	MMINLINE uintptr_t getElementSize() { return _elementSize; }
+
+	/**
+	 * Restrict scanning to the elements [startIndex, endIndex) of the array. This is only valid for arrays
+	 * whose elements are single reference slots and whose scan maps are derived from the scan/end pointers,
+	 * so that every element in the range is reported as a slot to scan.
+	 *
+	 * @param env The scanning thread environment
+	 * @param startIndex Index of the first element to scan
+	 * @param endIndex Index one past the last element to scan
+	 */
+	MMINLINE void
+	restrictToRange(MM_EnvironmentBase *env, uintptr_t startIndex, uintptr_t endIndex)
+	{
+		bool const compressed = env->compressObjectReferences();
+		Assert_MM_true(startIndex < endIndex);
+		Assert_MM_true(endIndex <= getIndexableRange());
+
+		_scanPtr = GC_SlotObject::addToSlotAddress(_basePtr, (intptr_t)startIndex, compressed);
+		_endPtr = GC_SlotObject::addToSlotAddress(_basePtr, (intptr_t)endIndex, compressed);
+		uintptr_t slotCount = endIndex - startIndex;
+		if (slotCount < (uintptr_t)_bitsPerScanMap) {
+			_scanMap = ((uintptr_t)1 << slotCount) - 1;
+		} else {
+			_scanMap = UDATA_MAX;
+		}
+		if (slotCount <= (uintptr_t)_bitsPerScanMap) {
+			setNoMoreSlots();
+		} else {
+			setMoreSlots();
+		}
+#if defined(OMR_GC_LEAF_BITS)
+		_leafMap = 0;
+#endif /* defined(OMR_GC_LEAF_BITS) */
+		if (0 != startIndex) {
+			clearHeadObjectScanner();
+		}
+	}
+
 	/**
 	* Return pointer to array object
 	*/
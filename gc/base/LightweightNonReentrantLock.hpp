@@ -90,6 +90,23 @@ public:
 		return true;
 	};
 
+	/**
+	 * Try to acquire the lock without waiting for it.
+	 * Unlike acquire(), a thread that finds the lock in use returns immediately
+	 * so that it can look for other work instead of queuing up behind the owner.
+	 *
+	 * @return TRUE if the lock was acquired, FALSE if it is currently in use
+	 * @note Creates a load/store barrier on success.
+	 */
+	MMINLINE bool tryAcquire()
+	{
+#if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
+		return 0 == omrgc_spinlock_tryAcquire(&_spinlock, _tracing);
+#else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+		return 0 == MUTEX_TRY_ENTER(_mutex);
+#endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+	};
+
 	/**
 	 * Release the lock.
 	 * If the current thread is not the owner of the lock, the
@@ -34,6 +34,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "IndexableObjectScanner.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 #include "Task.hpp"
@@ -113,6 +114,13 @@ MM_MarkingScheme::tearDown(MM_EnvironmentBase *env)
 		_markMap = NULL;
 	}
 
+#if defined(OMR_GC_REALTIME)
+	if (NULL != _extensions->sATBBarrierRememberedSet) {
+		_extensions->sATBBarrierRememberedSet->kill(env);
+		_extensions->sATBBarrierRememberedSet = NULL;
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+
 	if(_workPackets) {
 		_workPackets->kill(env);
 		_workPackets = NULL;
@@ -297,6 +305,12 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	GC_ObjectScannerState objectScannerState;
 	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
 	if (NULL != objectScanner) {
+		if ((0 != _extensions->markingArraySplitThreshold) && objectScanner->isIndexableObject() && !objectScanner->isIndexableObjectNoSplit()) {
+			GC_IndexableObjectScanner *indexableScanner = (GC_IndexableObjectScanner *)objectScanner;
+			if ((indexableScanner->getIndexableRange() > _extensions->markingArraySplitThreshold) && _delegate.isReferenceArray(env, objectPtr)) {
+				sizeToDo = splitIndexableObject(env, indexableScanner);
+			}
+		}
 		bool isLeafSlot = false;
 		GC_SlotObject *slotObject;
 #if defined(OMR_GC_LEAF_BITS)
@@ -313,6 +327,46 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 }
 
 
+uintptr_t
+MM_MarkingScheme::splitIndexableObject(MM_EnvironmentBase *env, GC_IndexableObjectScanner *objectScanner)
+{
+	omrobjectptr_t arrayPtr = objectScanner->getArrayObject();
+	uintptr_t endIndex = objectScanner->getIndexableRange();
+
+	/* a tail pushed by a previous split sits immediately beneath the array in the same packet */
+	uintptr_t startIndex = 0;
+	uintptr_t peekValue = (uintptr_t)env->_workStack.peek(env);
+	if (PACKET_ARRAY_SPLIT_TAG == (peekValue & PACKET_ARRAY_SPLIT_TAG)) {
+		env->_workStack.pop(env);
+		startIndex = peekValue >> PACKET_ARRAY_SPLIT_SHIFT;
+		Assert_MM_true(startIndex < endIndex);
+	}
+
+	uintptr_t remaining = endIndex - startIndex;
+	if (remaining > _extensions->markingArraySplitThreshold) {
+		/* hand out smaller ranges while other threads are waiting for work */
+		uintptr_t threadCount = env->_currentTask->getThreadCount();
+		uintptr_t splitAmount = remaining / (threadCount + (2 * _workPackets->getThreadWaitCount()));
+		splitAmount = OMR_MAX(splitAmount, _extensions->markingArraySplitMinimumAmount);
+		splitAmount = OMR_MIN(splitAmount, _extensions->markingArraySplitMaximumAmount);
+		if (splitAmount < remaining) {
+			uintptr_t splitIndex = startIndex + splitAmount;
+			env->_workStack.push(env, (void *)arrayPtr, (void *)((splitIndex << PACKET_ARRAY_SPLIT_SHIFT) | PACKET_ARRAY_SPLIT_TAG));
+			if (0 < _workPackets->getThreadWaitCount()) {
+				env->_workStack.flushOutputPacket(env);
+			}
+			endIndex = splitIndex;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_markStats._splitArraysProcessed += 1;
+			env->_markStats._splitArraysAmount += splitAmount;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+
+	objectScanner->restrictToRange(env, startIndex, endIndex);
+	return (endIndex - startIndex) * objectScanner->getElementSize();
+}
+
 /**
  * Scan until there are no more work packets to be processed.
  * @note This is a joining scan: a thread will not exit this method until
@@ -324,6 +378,10 @@ MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+			if (PACKET_ARRAY_SPLIT_TAG == ((uintptr_t)objectPtr & PACKET_ARRAY_SPLIT_TAG)) {
+				/* stray split tag whose array was consumed elsewhere (e.g. handled by overflow) */
+				continue;
+			}
 			env->_markStats._bytesScanned += scanObject(env, objectPtr);
 			env->_markStats._objectsScanned += 1;
 		}
@@ -38,6 +38,8 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+class GC_IndexableObjectScanner;
+
 /**
  * @todo Provide class documentation
  */
@@ -93,6 +95,17 @@ public:
 	void workerCleanupAfterGC(MM_EnvironmentBase *env);
 	void completeMarking(MM_EnvironmentBase *env);
 
+	/**
+	 * Called from scanObject() for reference arrays (see MM_MarkingDelegate::isReferenceArray()) larger than
+	 * markingArraySplitThreshold, just after the array was popped from the work stack of the calling thread.
+	 * Restricts the scanner to the next range of the array and pushes the remaining tail, tagged with its start
+	 * index, so that another marking thread can pick it up.
+	 * @param[in] env The scanning thread environment
+	 * @param[in] objectScanner Scanner for the array being scanned
+	 * @return the number of bytes in the range to be scanned by the caller
+	 */
+	uintptr_t splitIndexableObject(MM_EnvironmentBase *env, GC_IndexableObjectScanner *objectScanner);
+
 	/**
 	 *  Initialization for Mark
 	 *  Actual startup for Mark procedure
@@ -142,6 +142,8 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	clearSizeClassIndex();
+
 	return true;
 }
 
@@ -411,6 +413,59 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	/* The entries added below freeEntry may be larger than anything the index has seen */
+	clearSizeClassIndex();
+}
+
+/****************************************
+ * Size Class Index Functionality
+ ****************************************
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_COUNT; sizeClass++) {
+		_sizeClassIndex[sizeClass] = NULL;
+	}
+}
+
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassIndexEntry(uintptr_t sizeClass)
+{
+	MM_HeapLinkedFreeHeader *indexEntry = _sizeClassIndex[sizeClass];
+
+	if ((NULL != indexEntry) && (FREE_ENTRY_END != indexEntry)) {
+		/* As with hints, an entry below the head of the list was consumed by a TLH allocate */
+		if ((NULL == _heapFreeList) || (indexEntry < _heapFreeList)) {
+			_sizeClassIndex[sizeClass] = NULL;
+			indexEntry = NULL;
+		}
+	}
+
+	return indexEntry;
+}
+
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestSize)
+{
+	/* Every size class above largestSize may start its walk past freeEntry */
+	uintptr_t sizeClass = (0 == largestSize) ? 0 : (getSizeClass(largestSize) + 1);
+	for (; sizeClass < FREE_LIST_SIZE_CLASS_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] < freeEntry) {
+			_sizeClassIndex[sizeClass] = freeEntry;
+		}
+	}
+}
+
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] == oldFreeEntry) {
+			_sizeClassIndex[sizeClass] = newFreeEntry;
+		}
+	}
 }
 
 /****************************************
@@ -428,6 +483,9 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	uintptr_t sizeClass = getSizeClass(sizeInBytesRequired);
+	bool useSizeClassIndex = false;
+	bool walkSkipped = false;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
@@ -450,6 +508,24 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* The size class index is not maintained while free entries are being card aligned */
+	useSizeClassIndex = (FREE_ENTRY_END == _firstUnalignedFreeEntry);
+	walkSkipped = false;
+	if (useSizeClassIndex) {
+		MM_HeapLinkedFreeHeader *indexEntry = findSizeClassIndexEntry(sizeClass);
+		if (FREE_ENTRY_END == indexEntry) {
+			/* A previous walk found nothing this large and no entry has been added or grown since */
+			currentFreeEntry = NULL;
+			walkSkipped = true;
+		} else if ((NULL != indexEntry) && ((NULL == allocateHintUsed) || (indexEntry > allocateHintUsed->heapFreeHeader))) {
+			/* The index starts further up the list than the hint; indexEntry itself is too small so the walk starts after it */
+			previousFreeEntry = indexEntry;
+			currentFreeEntry = indexEntry->getNext(compressed);
+			candidateHintSize = ((uintptr_t)1 << sizeClass) - 1;
+			allocateHintUsed = NULL;
+		}
+	}
+
 
 	while(currentFreeEntry) {
 		if (doesNeedAlignment(env, currentFreeEntry)) {
@@ -480,6 +556,8 @@ retry:
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
 	}
 
+	_largeObjectAllocateStats->recordFreeListWalk(walkCount);
+
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -487,9 +565,17 @@ retry:
 			goto retry;
 		}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+		if (useSizeClassIndex && !walkSkipped) {
+			/* The rest of the list was walked so no entry is larger than candidateHintSize */
+			updateSizeClassIndex(FREE_ENTRY_END, candidateHintSize);
+		}
 		goto fail_allocate;
 	}
 
+	if (useSizeClassIndex && (NULL != previousFreeEntry)) {
+		updateSizeClassIndex(previousFreeEntry, candidateHintSize);
+	}
+
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
@@ -514,6 +600,7 @@ retry:
 			_prevFirstUnalignedFreeEntry = recycleEntry;
 		}
 		updateHint(currentFreeEntry, recycleEntry);
+		replaceSizeClassIndexEntry(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		if (currentFreeEntry->getNext(compressed) == _firstUnalignedFreeEntry) {
@@ -528,6 +615,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		replaceSizeClassIndexEntry(currentFreeEntry, previousFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -545,7 +633,9 @@ retry:
 
 fail_allocate:
 	/* Since we failed to allocate, update the largest free entry so that outside callers will be able to skip this pool, next time, in Tarok configurations */
-	setLargestFreeEntry(largestFreeEntry);
+	if (!walkSkipped) {
+		setLargestFreeEntry(largestFreeEntry);
+	}
 	if (lockingRequired) {
 		_heapLock.release();
 	}
@@ -748,6 +838,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	clearSizeClassIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -823,6 +914,36 @@ MM_MemoryPoolAddressOrderedList::isValidListOrdering()
 }
 #endif
 
+bool
+MM_MemoryPoolAddressOrderedList::isValidSizeClassIndex()
+{
+	bool const compressed = compressObjectReferences();
+	for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_COUNT; sizeClass++) {
+		MM_HeapLinkedFreeHeader *indexEntry = _sizeClassIndex[sizeClass];
+		if (NULL == indexEntry) {
+			continue;
+		}
+		if ((FREE_ENTRY_END != indexEntry) && ((NULL == _heapFreeList) || (indexEntry < _heapFreeList))) {
+			/* Consumed from the head of the list; findSizeClassIndexEntry() discards it */
+			continue;
+		}
+
+		bool found = false;
+		MM_HeapLinkedFreeHeader *walk = _heapFreeList;
+		while ((NULL != walk) && !found) {
+			if (getSizeClass(walk->getSize()) >= sizeClass) {
+				return false;
+			}
+			found = (walk == indexEntry);
+			walk = walk->getNext(compressed);
+		}
+		if ((FREE_ENTRY_END != indexEntry) && !found) {
+			return false;
+		}
+	}
+	return true;
+}
+
 /**
  * Add the range of memory to the free list of the receiver.
  *
@@ -849,6 +970,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	clearSizeClassIndex();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -969,6 +1092,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 
 	assume0(NULL != currentFreeEntry);  /* Can't contract what doesn't exist */
 
+	clearSizeClassIndex();
+
 	totalContractSize = contractSize;
 	contractCount = 1;
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
@@ -1041,6 +1166,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	clearSizeClassIndex();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1163,6 +1290,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 		return false;
 	}
 
+	clearSizeClassIndex();
+
 	/* Remember the next free entry after the current one which we are going to consume at least part of */
 	nextFreeEntry = currentFreeEntry->getNext(compressed);
 
@@ -1503,6 +1632,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1581,6 +1712,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	/* Was chunk big enough to be recycled ? */
 	if(recycled) {
+		clearSizeClassIndex();
+
 		/* Adjust the free memory size and free entry count*/
 		uintptr_t chunkSize = (uintptr_t)chunkTop - (uintptr_t)chunkBase;
 		_freeMemorySize += chunkSize;
@@ -1751,6 +1884,10 @@ MM_MemoryPoolAddressOrderedList::doFreeEntryAlignmentUpTo(MM_EnvironmentBase *en
 
 	uintptr_t freeBytes = _freeMemorySize;
 	uintptr_t freeEntryCount = _freeEntryCount;
+
+	/* Entries may be removed from the list below */
+	clearSizeClassIndex();
+
 	while ((currentFreeEntry <= lastFreeEntryToAlign) && (NULL != currentFreeEntry)) {
 		uintptr_t freeEntrySize = currentFreeEntry->getSize();
 		void *endFreeEntry = (void *) ((uintptr_t)currentFreeEntry + freeEntrySize);
@@ -33,6 +33,7 @@
 #include "HeapRegionDescriptor.hpp"
 #include "EnvironmentBase.hpp"
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 
 class MM_AllocateDescription;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -40,6 +41,7 @@ class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #define FREE_ENTRY_END ((MM_HeapLinkedFreeHeader *)OMRPORT_VMEM_MAX_ADDRESS)
+#define FREE_LIST_SIZE_CLASS_COUNT (sizeof(uintptr_t) * 8)
 
 /**
  * @todo Provide class documentation
@@ -60,6 +62,9 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class index support */
+	MM_HeapLinkedFreeHeader *_sizeClassIndex[FREE_LIST_SIZE_CLASS_COUNT]; /**< For size class c, a free entry such that it and all entries below it are smaller than 2^c, FREE_ENTRY_END if no entry is that large, or NULL if unknown */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -78,6 +83,40 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Answer the size class index (floor of log2) for the given size.
+	 * Note MM_Bits::trailingZeroes counts the zero bits above the highest set bit.
+	 */
+	MMINLINE uintptr_t getSizeClass(uintptr_t size)
+	{
+		return (FREE_LIST_SIZE_CLASS_COUNT - 1) - MM_Bits::trailingZeroes(size);
+	}
+
+	/**
+	 * Forget everything the size class index knows. Used by the paths which insert or grow free
+	 * entries, since any of them can break the "all entries below are smaller" invariant.
+	 */
+	void clearSizeClassIndex();
+
+	/**
+	 * Find where a walk for the given size class may start.
+	 * @return a free entry which, together with all entries below it, is too small for the size class,
+	 * FREE_ENTRY_END if no entry in the list is large enough, or NULL if the walk must start at the head
+	 */
+	MM_HeapLinkedFreeHeader *findSizeClassIndexEntry(uintptr_t sizeClass);
+
+	/**
+	 * Record that freeEntry and all free entries below it are no larger than largestSize.
+	 * @param freeEntry the last entry walked, or FREE_ENTRY_END if the whole list was walked
+	 */
+	void updateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestSize);
+
+	/**
+	 * Replace oldFreeEntry in the size class index, because it was split or removed from the list.
+	 * @param newFreeEntry the remainder of the split entry, or the entry preceding a removed one (NULL if none)
+	 */
+	void replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
@@ -121,6 +160,14 @@ public:
 	virtual bool isValidListOrdering();
 #endif
 
+	/**
+	 * Verify every size class index entry against the free list: a known entry must be in the list and it,
+	 * together with all entries below it, must be smaller than its size class. FREE_ENTRY_END requires
+	 * that no entry in the list is that large.
+	 * @return true if the size class index is consistent with the free list
+	 */
+	bool isValidSizeClassIndex();
+
 	virtual void addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
 												uintptr_t freeListMemoryCount, uintptr_t freeListMemorySize);
 	
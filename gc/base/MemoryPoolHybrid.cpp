@@ -141,6 +141,8 @@ MM_MemoryPoolHybrid::internalAllocate(MM_EnvironmentBase* env, uintptr_t sizeInB
 	uintptr_t recycleEntrySize = 0;
 	void* addrBase = NULL;
 
+	bool const tryLockAffineFreeList = env->getExtensions()->splitFreeListTryLock;
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -156,12 +158,10 @@ retry:
 	suggestedFreeList = curFreeList;
 
 	do {
-		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
+		/* the first probe is of this thread's affine list; if another thread holds it, move on rather than wait */
+		if ((NULL != _heapFreeLists[curFreeList]._freeList)
+			&& (!lockingRequired || acquireFreeList(curFreeList, firstIteration && skipReserved && tryLockAffineFreeList))
+		) {
 			currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
 			if (NULL != currentFreeEntry) {
 				/* found a freeEntry; will release lock only after we handle the remainder */
@@ -178,7 +178,7 @@ retry:
 		jumpedToSuggested = false;
 		if (firstIteration) {
 			firstIteration = false;
-			suggestedFreeList = findGoodStartFreeList();
+			suggestedFreeList = findGoodStartFreeList(curFreeList);
 			curFreeList = suggestedFreeList;
 			jumpedToSuggested = true;
 		} else {
@@ -271,6 +271,8 @@ MM_MemoryPoolHybrid::internalAllocateTLH(MM_EnvironmentBase* env, uintptr_t maxi
 	uintptr_t suggestedFreeList;
 	uintptr_t curFreeList;
 
+	bool const tryLockAffineFreeList = env->getExtensions()->splitFreeListTryLock;
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -288,12 +290,10 @@ retry:
 	suggestedFreeList = curFreeList;
 
 	do {
-		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
+		/* the first probe is of this thread's affine list; if another thread holds it, move on rather than wait */
+		if ((NULL != _heapFreeLists[curFreeList]._freeList)
+			&& (!lockingRequired || acquireFreeList(curFreeList, firstIteration && skipReserved && tryLockAffineFreeList))
+		) {
 			freeEntry = _heapFreeLists[curFreeList]._freeList;
 
 			if (NULL != freeEntry) {
@@ -309,7 +309,7 @@ retry:
 		jumpedToSuggested = false;
 		if (firstIteration) {
 			firstIteration = false;
-			suggestedFreeList = findGoodStartFreeList();
+			suggestedFreeList = findGoodStartFreeList(curFreeList);
 			curFreeList = suggestedFreeList;
 			jumpedToSuggested = true;
 		} else {
@@ -137,6 +137,7 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 	}
 	
 	_allocSearchCount += walkCountCurrentList;
+	_largeObjectAllocateStatsForFreeList[curFreeList].recordFreeListWalk(walkCountCurrentList);
 	
 	return currentFreeEntry;
 }
@@ -155,6 +156,8 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocate(MM_EnvironmentBase* env,
 	uintptr_t recycleEntrySize = 0;
 	void* addrBase = NULL;
 
+	bool const tryLockAffineFreeList = env->getExtensions()->splitFreeListTryLock;
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -173,12 +176,10 @@ retry:
 	suggestedFreeList = curFreeList;
 
 	do {
-		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
+		/* the first probe is of this thread's affine list; if another thread holds it, move on rather than wait */
+		if ((NULL != _heapFreeLists[curFreeList]._freeList)
+			&& (!lockingRequired || acquireFreeList(curFreeList, firstIteration && skipReserved && tryLockAffineFreeList))
+		) {
 			if (skipReserved) {
 				/* first pass will skip reserved free entry */
 				currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
@@ -205,7 +206,7 @@ retry:
 		jumpedToSuggested = false;
 		if (firstIteration) {
 			firstIteration = false;
-			suggestedFreeList = findGoodStartFreeList();
+			suggestedFreeList = findGoodStartFreeList(curFreeList);
 			curFreeList = suggestedFreeList;
 			jumpedToSuggested = true;
 		} else {
@@ -312,6 +313,8 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* en
 	uintptr_t suggestedFreeList;
 	uintptr_t curFreeList;
 
+	bool const tryLockAffineFreeList = env->getExtensions()->splitFreeListTryLock;
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -332,12 +335,10 @@ retry:
 	suggestedFreeList = curFreeList;
 
 	do {
-		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
+		/* the first probe is of this thread's affine list; if another thread holds it, move on rather than wait */
+		if ((NULL != _heapFreeLists[curFreeList]._freeList)
+			&& (!lockingRequired || acquireFreeList(curFreeList, firstIteration && skipReserved && tryLockAffineFreeList))
+		) {
 			if (!skipReserved) {
 				/* second pass will directly use reserved free entry */
 				freeEntry = getReservedFreeEntry();
@@ -372,7 +373,7 @@ retry:
 		jumpedToSuggested = false;
 		if (firstIteration) {
 			firstIteration = false;
-			suggestedFreeList = findGoodStartFreeList();
+			suggestedFreeList = findGoodStartFreeList(curFreeList);
 			curFreeList = suggestedFreeList;
 			jumpedToSuggested = true;
 		} else {
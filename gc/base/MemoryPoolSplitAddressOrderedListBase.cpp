@@ -112,6 +112,7 @@ void J9ModronFreeList::reset()
 	_freeSize = 0;
 	_freeCount = 0;
 	_timesLocked = 0;
+	_timesContended = 0;
 	clearHints();
 }
 
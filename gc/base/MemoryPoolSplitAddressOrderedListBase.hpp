@@ -44,6 +44,7 @@ public:
 	MM_LightweightNonReentrantLock _lock;
 	MM_HeapLinkedFreeHeader* _freeList;
 	uintptr_t _timesLocked;
+	uintptr_t _timesContended; /**< number of times a thread found this list locked and moved on to another list (approximate, updated without the lock) */
 
 	uintptr_t _freeSize;
 	uintptr_t _freeCount;
@@ -240,6 +241,7 @@ public:
 	J9ModronFreeList()
 		: _freeList(NULL)
 		, _timesLocked(0)
+		, _timesContended(0)
 		, _freeSize(0)
 		, _freeCount(0)
 		, _hintActive(NULL)
@@ -279,19 +281,59 @@ protected:
 
 	bool recycleHeapChunkForFreeList(MM_EnvironmentBase* env, void* addrBase, void* addrTop, MM_HeapLinkedFreeHeader* previousFreeEntry, MM_HeapLinkedFreeHeader* nextFreeEntry, uintptr_t curFreeList);
 
-	MMINLINE uintptr_t findGoodStartFreeList()
+	/**
+	 * Pick the least contended non-empty free list to continue a search from.
+	 * Lists that other threads have recently been found holding count against a list, so that
+	 * threads leaving a busy list spread out rather than converge on the same alternative.
+	 *
+	 * @param[in] excludedFreeList a list that was just tried and should only be picked if no other list has entries
+	 * @return index of the free list to try next
+	 */
+	MMINLINE uintptr_t findGoodStartFreeList(uintptr_t excludedFreeList = UDATA_MAX)
 	{
 		uintptr_t index = 0;
 		uintptr_t timesLocked = UDATA_MAX;
+		bool found = false;
 		for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
-			if ((NULL != _heapFreeLists[i]._freeList) && (_heapFreeLists[i]._timesLocked < timesLocked)) {
-				index = i;
-				timesLocked = _heapFreeLists[i]._timesLocked;
+			if ((i != excludedFreeList) && (NULL != _heapFreeLists[i]._freeList)) {
+				uintptr_t weight = _heapFreeLists[i]._timesLocked + _heapFreeLists[i]._timesContended;
+				if (weight < timesLocked) {
+					index = i;
+					timesLocked = weight;
+					found = true;
+				}
 			}
 		}
+		if (!found && (excludedFreeList < _heapFreeListCount)) {
+			index = excludedFreeList;
+		}
 		return index;
 	}
 
+	/**
+	 * Lock a free list for allocation.
+	 * When avoidContention is set (the thread's own affine list on its first probe) a list that is
+	 * already held is not waited for; the contention is recorded and the caller moves on to another list.
+	 *
+	 * @param[in] freeListIndex index of the free list to lock
+	 * @param[in] avoidContention give up rather than wait if the list is in use
+	 * @return true if the list is now locked by the caller
+	 */
+	MMINLINE bool acquireFreeList(uintptr_t freeListIndex, bool avoidContention)
+	{
+		J9ModronFreeList* freeList = &_heapFreeLists[freeListIndex];
+		if (avoidContention) {
+			if (!freeList->_lock.tryAcquire()) {
+				freeList->_timesContended += 1;
+				return false;
+			}
+		} else {
+			freeList->_lock.acquire();
+		}
+		freeList->_timesLocked += 1;
+		return true;
+	}
+
 	/**
 	 * set Next of the freeEntry with new freeEntry pointer
 	 *
@@ -26,6 +26,7 @@
 #include "omrmodroncore.h"
 
 #include "AllocateDescription.hpp"
+#include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
 #include "PhysicalSubArena.hpp"
@@ -95,6 +96,9 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
+	if (MM_GCExtensionsBase::HEAP_RESIZE_POLICY_GC_COST == _extensions->heapResizePolicy) {
+		updateGCCostModel(env);
+	}
 	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
@@ -285,20 +289,35 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 		}
 	}
 	
-	/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
-	if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
-		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit2(env->getLanguageVMThread());
-		return false;
-	}
-	
-	/* No need to shrink if we will not be above -Xmaxf after satisfying the allocate */
 	uintptr_t allocSize = allocDescription ? allocDescription->getBytesRequested() : 0;
-	
-	/* Are we spending too little time in GC ? */
-	bool ratioContract = checkForRatioContract(env);
-	
-	/* How much, if any, do we need to contract by ? */
-	_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	bool ratioContract = false;
+	bool idleContract = false;
+	uintptr_t gcCostHeapSize = 0;
+
+	if (MM_GCExtensionsBase::HEAP_RESIZE_POLICY_GC_COST == _extensions->heapResizePolicy) {
+		idleContract = isIdleGC(env);
+		gcCostHeapSize = calculateGCCostTargetHeapSize(env, allocSize, idleContract);
+	}
+
+	if (0 != gcCostHeapSize) {
+		/* The cost model replaces both the -Xmaxf limit and the GC time thresholds */
+		ratioContract = true;
+		_contractionSize = calculateGCCostContractSize(env, gcCostHeapSize, idleContract);
+	} else {
+		/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
+		if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
+			Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit2(env->getLanguageVMThread());
+			return false;
+		}
+
+		/* Are we spending too little time in GC ? */
+		ratioContract = checkForRatioContract(env);
+
+		/* How much, if any, do we need to contract by ?
+		 * No need to shrink if we will not be above -Xmaxf after satisfying the allocate
+		 */
+		_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	}
 	
 	if (_contractionSize == 0 ) {
 		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit3(env->getLanguageVMThread());
@@ -307,8 +326,12 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	
 
 	
-	/* Don't shrink if we expanded in last extensions->heapContractionStabilizationCount global collections */
-	if (_extensions->isStandardGC() || _extensions->isMetronomeGC()) {
+	/* Don't shrink if we expanded in last extensions->heapContractionStabilizationCount global collections.
+	 * An idle heap releases its memory regardless; the application is not allocating to make use of it.
+	 */
+	if (idleContract) {
+		/* no stabilization required */
+	} else if (_extensions->isStandardGC() || _extensions->isMetronomeGC()) {
 		uintptr_t gcCount = 0;
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 		gcCount = _extensions->globalGCStats.gcCount;
@@ -325,7 +348,7 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	/* Don't shrink if its a system GC and we had less than -Xminf free at 
 	 * the start of the garbage collection 
 	 */ 
-	 if (systemGC) {
+	 if (systemGC && !idleContract) {
 		uintptr_t heapFreeMinimumHeuristicMultiplier = getHeapFreeMinimumHeuristicMultiplier(env);
 	 	uintptr_t minimumFree = (getActiveMemorySize() / _extensions->heapFreeMinimumRatioDivisor) 
 								* heapFreeMinimumHeuristicMultiplier;
@@ -339,7 +362,9 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	 }	
 	
 	/* Remember reason for contraction for later */
-	if (ratioContract) {
+	if (idleContract) {
+		_extensions->heap->getResizeStats()->setLastContractReason(IDLE_CONTRACT);
+	} else if (ratioContract) {
 		_extensions->heap->getResizeStats()->setLastContractReason(GC_RATIO_TOO_LOW);
 	} else {
 		_extensions->heap->getResizeStats()->setLastContractReason(FREE_SPACE_GREATER_MAXF);
@@ -467,7 +492,11 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 #endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 			if (_extensions->heap->getResizeStats()->getLastHeapExpansionGCCount() + _extensions->heapExpansionStabilizationCount <= gcCount ) {
 				/* Determine if its time for a ratio expand ? */
-				expandSize = checkForRatioExpand(env,bytesRequired);
+				if (MM_GCExtensionsBase::HEAP_RESIZE_POLICY_GC_COST == _extensions->heapResizePolicy) {
+					expandSize = checkForGCCostExpand(env, bytesRequired);
+				} else {
+					expandSize = checkForRatioExpand(env,bytesRequired);
+				}
 			}
 		} else {
 			Assert_MM_unimplemented();
@@ -672,6 +701,133 @@ MM_MemorySubSpaceUniSpace::checkForRatioContract(MM_EnvironmentBase *env)
 }
 
 
+/**
+ * Refine the GC cost model from the global collection that just completed.
+ * @note We use the approximate heap size to account for defered work that may during execution free up more memory.
+ */
+void
+MM_MemorySubSpaceUniSpace::updateGCCostModel(MM_EnvironmentBase *env)
+{
+	uint32_t gcPercentage = 0;
+
+	if (NULL != _collector) {
+		gcPercentage = _collector->getGCTimePercentage(env);
+	} else {
+		gcPercentage = _extensions->getGlobalCollector()->getGCTimePercentage(env);
+	}
+
+	_extensions->heap->getResizeStats()->updateGCCostModel(gcPercentage, getApproximateActiveFreeMemorySize());
+}
+
+/**
+ * Determine if the current collection was requested because the application is idle.
+ * @return true if the collection is an idle GC, false otherwise
+ */
+bool
+MM_MemorySubSpaceUniSpace::isIdleGC(MM_EnvironmentBase *env)
+{
+	bool idle = false;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	idle = (NULL != env->_cycleState) && (J9MMCONSTANT_EXPLICIT_GC_IDLE_GC == env->_cycleState->_gcCode.getCode());
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+	return idle;
+}
+
+/**
+ * Determine the heap size recommended by the GC cost model.
+ * The heap leaves free the memory that the model predicts keeps the time spent in GC at
+ * heapResizeTargetGCPercentage, and never less than -Xminf of the resulting heap. An idle
+ * application spends no time in GC, so an idle heap is sized down to the -Xminf floor.
+ * @note We use the approximate heap size to account for defered work that may during execution free up more memory.
+ * @return the recommended active memory size, or 0 if the model has not been measured yet
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateGCCostTargetHeapSize(MM_EnvironmentBase *env, uintptr_t bytesRequired, bool idle)
+{
+	MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+	uintptr_t targetFree = 0;
+
+	if (!idle) {
+		if (!resizeStats->isGCCostModelValid()) {
+			return 0;
+		}
+		targetFree = OMR_MIN(resizeStats->predictFreeBytesForGCPercentage(_extensions->heapResizeTargetGCPercentage), getMaximumSize());
+	}
+
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	uintptr_t liveBytes = (currentHeapSize > currentFree) ? (currentHeapSize - currentFree) : 0;
+
+	/* How big a heap leaves -Xminf free given current live data */
+	uintptr_t heapFreeMinimumHeuristicMultiplier = getHeapFreeMinimumHeuristicMultiplier(env);
+	uintptr_t minimumHeapSize = (liveBytes / (_extensions->heapFreeMinimumRatioDivisor - heapFreeMinimumHeuristicMultiplier))
+								* _extensions->heapFreeMinimumRatioDivisor;
+
+	uintptr_t targetHeapSize = OMR_MAX(minimumHeapSize, liveBytes + targetFree) + bytesRequired;
+
+	return MM_Math::roundToCeiling(_extensions->heapAlignment, targetHeapSize);
+}
+
+/**
+ * Determine how much to expand by to reach the heap size recommended by the GC cost model.
+ * Falls back to a ratio expand until the model has been measured.
+ * @return expand size if the modelled time spent in GC is above target, or 0 otherwise
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::checkForGCCostExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired)
+{
+	uintptr_t targetHeapSize = calculateGCCostTargetHeapSize(env, bytesRequired, false);
+
+	if (0 == targetHeapSize) {
+		return checkForRatioExpand(env, bytesRequired);
+	}
+
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	if (targetHeapSize <= currentHeapSize) {
+		return 0;
+	}
+
+	return targetHeapSize - currentHeapSize;
+}
+
+/**
+ * Determine how much to contract by to reach the heap size recommended by the GC cost model.
+ * Outside of idle the contraction is limited like any other (see calculateTargetContractSize),
+ * while an idle heap is released in full, in multiples of region size.
+ * @return the recommended amount of heap in bytes to contract.
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateGCCostContractSize(MM_EnvironmentBase *env, uintptr_t targetHeapSize, bool idle)
+{
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	uintptr_t contractionGranule = _extensions->regionSize;
+
+	if (targetHeapSize >= currentHeapSize) {
+		return 0;
+	}
+
+	uintptr_t contractionSize = currentHeapSize - targetHeapSize;
+	uintptr_t minContract = 0;
+
+	if (!idle) {
+		/* But we don't contract too quickly or by a trivial amount */
+		uintptr_t maxContract = (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction);
+		minContract = (uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction);
+
+		maxContract = MM_Math::roundToCeiling(contractionGranule, OMR_MAX(maxContract, contractionGranule));
+		contractionSize = OMR_MIN(contractionSize, maxContract);
+	}
+
+	/* We will contract in multiples of region size. Result may become zero */
+	contractionSize = MM_Math::roundToFloor(contractionGranule, contractionSize);
+
+	if (contractionSize < minContract) {
+		contractionSize = 0;
+	}
+
+	return contractionSize;
+}
+
 /**
  * Compare the specified expand amount with the specified minimum and maximum expansion amounts
  * (-Xmine and -Xmaxe command line options) and round the amount to within these limits
@@ -46,6 +46,11 @@ protected:
 	uintptr_t adjustExpansionWithinSoftMax(MM_EnvironmentBase *env, uintptr_t expandSize, uintptr_t minimumBytesRequired);
 	uintptr_t checkForRatioExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired);	
 	bool checkForRatioContract(MM_EnvironmentBase *env);
+	void updateGCCostModel(MM_EnvironmentBase *env);
+	bool isIdleGC(MM_EnvironmentBase *env);
+	uintptr_t calculateGCCostTargetHeapSize(MM_EnvironmentBase *env, uintptr_t bytesRequired, bool idle);
+	uintptr_t checkForGCCostExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired);
+	uintptr_t calculateGCCostContractSize(MM_EnvironmentBase *env, uintptr_t targetHeapSize, bool idle);
 	uintptr_t calculateExpandSize(MM_EnvironmentBase *env, uintptr_t bytesRequired, bool expandToSatisfy);
 	uintptr_t calculateCollectorExpandSize(MM_EnvironmentBase *env, MM_Collector *requestCollector, MM_AllocateDescription *allocDescription);
 	uintptr_t calculateTargetContractSize(MM_EnvironmentBase *env, uintptr_t allocSize, bool ratioContract);
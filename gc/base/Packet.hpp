@@ -45,6 +45,7 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uintptr_t _packetIndex; /**< 1-based index of the packet within its MM_WorkPackets, used by MM_PacketStack */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -75,6 +76,19 @@ public:
 		return (uintptr_t)(_topPtr - _currentPtr);
 	}
 
+	/**
+	 * Returns the 1-based index of the packet within its MM_WorkPackets
+	 */
+	MMINLINE uintptr_t getPacketIndex()
+	{
+		return _packetIndex;
+	}
+
+	MMINLINE void setPacketIndex(uintptr_t packetIndex)
+	{
+		_packetIndex = packetIndex;
+	}
+
 	/**
 	 * Sets the address of the owning threads env
 	 */
@@ -99,6 +113,15 @@ public:
 	{
 		_owner = (MM_EnvironmentBase *)((uintptr_t)_owner | PACKET_RETURNED);
 	}
+
+	/**
+	 * Determine whether the packet has been handed back by the thread which last used it
+	 * @return true if the owner has been low tagged by resetOwner()
+	 */
+	MMINLINE bool isReturned()
+	{
+		return PACKET_RETURNED == ((uintptr_t)_owner & PACKET_RETURNED);
+	}
 	
 	void *peek(MM_EnvironmentBase *env);
 	
@@ -212,6 +235,7 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetIndex(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
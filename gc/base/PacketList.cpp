@@ -169,6 +169,66 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	list->_lock.release();
 }
 
+uintptr_t
+MM_PacketList::removeReturned(MM_Packet **head, MM_Packet **tail)
+{
+	uintptr_t removed = 0;
+
+	*head = NULL;
+	*tail = NULL;
+
+	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		PacketSublist *list = &_sublists[i];
+
+		/* unlocked peek; a packet returned concurrently is picked up by the next caller */
+		if (NULL == list->_head) {
+			continue;
+		}
+
+		list->_lock.acquire();
+
+		uintptr_t removedFromSublist = 0;
+		MM_Packet *packet = list->_head;
+		while (NULL != packet) {
+			MM_Packet *next = packet->_next;
+			if (packet->isReturned()) {
+				/* unlink from the sublist */
+				if (NULL == packet->_previous) {
+					list->_head = next;
+				} else {
+					packet->_previous->_next = next;
+				}
+				if (NULL == next) {
+					list->_tail = packet->_previous;
+				} else {
+					next->_previous = packet->_previous;
+				}
+
+				/* append to the chain */
+				packet->_next = NULL;
+				packet->_previous = *tail;
+				if (NULL == *tail) {
+					*head = packet;
+				} else {
+					(*tail)->_next = packet;
+				}
+				*tail = packet;
+				removedFromSublist += 1;
+			}
+			packet = next;
+		}
+
+		if (0 != removedFromSublist) {
+			decrementCount(removedFromSublist);
+			removed += removedFromSublist;
+		}
+
+		list->_lock.release();
+	}
+
+	return removed;
+}
+
 /**
  * Return the first element in the list.
  * This should be avoided as it combines all sublists in to one
@@ -152,6 +152,18 @@ public:
 	 */
 	bool popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count);
 	void remove(MM_Packet *packetToRemove);
+
+	/**
+	 * Unlink every returned packet (see MM_Packet::isReturned()) from this packet list
+	 * into a single doubly linked chain. Each sublist lock is held only while that
+	 * sublist is walked.
+	 *
+	 * @param head The first entry in the chain
+	 * @param tail The last entry in the chain
+	 *
+	 * @return the number of entries in the chain
+	 */
+	uintptr_t removeReturned(MM_Packet **head, MM_Packet **tail);
 	
 	/**
 	 * Push a packet on the packetList.
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(PACKETSTACK_HPP_)
+#define PACKETSTACK_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "Packet.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Lock-free (Treiber) stack of work packets, used for the empty packet list when workPacketsLockFree is enabled.
+ * The head is a 64-bit word holding the 1-based index of the top packet in the low half and a modification tag
+ * in the high half. Every push and pop increments the tag, so a pop racing with a pop/push of the same packet
+ * (ABA) fails its compare-and-swap instead of installing a stale next pointer. Packets are never freed while the
+ * stack is in use, so reading the next pointer of a packet that has just been popped by another thread is safe.
+ * @ingroup GC_Base_Core
+ */
+class MM_PacketStack : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uint64_t _head; /**< (tag << 32) | index of the top packet, index 0 denotes an empty stack */
+	volatile uintptr_t _count; /**< number of packets on the stack, never below the actual count */
+	MM_Packet **_packetTable; /**< maps (index - 1) to the packet, shared with the owning MM_WorkPackets */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uint64_t
+	makeHead(uint64_t oldHead, MM_Packet *packet)
+	{
+		uint64_t index = (NULL == packet) ? 0 : (uint64_t)packet->getPacketIndex();
+		return (((oldHead >> 32) + 1) << 32) | index;
+	}
+
+public:
+	/**
+	 * @param packetTable[in] table mapping packet indices to packets, filled in as packet blocks are allocated
+	 */
+	bool
+	initialize(MM_EnvironmentBase *env, MM_Packet **packetTable)
+	{
+		_packetTable = packetTable;
+		return NULL != _packetTable;
+	}
+
+	/**
+	 * Push a chain of packets linked through _next.
+	 * @param head[in] first packet of the chain
+	 * @param tail[in] last packet of the chain
+	 * @param count[in] number of packets in the chain
+	 */
+	MMINLINE void
+	pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
+	{
+		/* count first so that a racing pop can never take the count below zero */
+		MM_AtomicOperations::add(&_count, count);
+		head->_previous = NULL;
+		uint64_t oldHead = 0;
+		do {
+			oldHead = _head;
+			uintptr_t topIndex = (uintptr_t)(oldHead & U_32_MAX);
+			tail->_next = (0 == topIndex) ? NULL : _packetTable[topIndex - 1];
+		} while (oldHead != MM_AtomicOperations::lockCompareExchangeU64(&_head, oldHead, makeHead(oldHead, head)));
+	}
+
+	/**
+	 * Push a single packet.
+	 */
+	MMINLINE void
+	push(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		pushList(packet, packet, 1);
+	}
+
+	/**
+	 * Pop the top packet.
+	 * @return the packet, or NULL if the stack is empty
+	 */
+	MMINLINE MM_Packet *
+	pop(MM_EnvironmentBase *env)
+	{
+		MM_Packet *packet = NULL;
+		uint64_t oldHead = 0;
+		do {
+			oldHead = _head;
+			uintptr_t topIndex = (uintptr_t)(oldHead & U_32_MAX);
+			if (0 == topIndex) {
+				return NULL;
+			}
+			packet = _packetTable[topIndex - 1];
+		} while (oldHead != MM_AtomicOperations::lockCompareExchangeU64(&_head, oldHead, makeHead(oldHead, packet->_next)));
+
+		MM_AtomicOperations::subtract(&_count, 1);
+		packet->_next = NULL;
+		return packet;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == (_head & U_32_MAX); }
+
+	/**
+	 * Number of packets on the stack. May transiently exceed the actual count while a push is in progress.
+	 */
+	MMINLINE uintptr_t getCount() { return _count; }
+
+	MM_PacketStack()
+		: MM_BaseNonVirtual()
+		, _head(0)
+		, _count(0)
+		, _packetTable(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PACKETSTACK_HPP_ */
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
 #include "ParallelHeapWalker.hpp"
 
 #include "ModronAssertions.h"
@@ -80,6 +82,53 @@ public:
 	}
 };
 
+/**
+ * Task running an accumulating parallel object walk; see MM_ParallelHeapWalker::allObjectsDoAccumulate
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectAccumulateTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectAccumulateFunc _function;
+	void *_userData;
+	uintptr_t _walkFlags;
+	uint8_t *_accumulators; /**< one accumulator per possible worker, _accumulatorStride bytes apart */
+	uintptr_t _accumulatorStride; /**< accumulator size rounded up to a cache line so threads do not share lines */
+	bool *_participated; /**< per worker flag, set once the worker has walked its chunks */
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/*
+	 * Create a ParallelObjectAccumulateTask object.
+	 */
+	MM_ParallelObjectAccumulateTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectAccumulateFunc function, void *userData, uintptr_t walkFlags, uint8_t *accumulators, uintptr_t accumulatorStride, bool *participated)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _walkFlags(walkFlags)
+		, _accumulators(accumulators)
+		, _accumulatorStride(accumulatorStride)
+		, _participated(participated)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -101,6 +150,15 @@ MM_ParallelHeapWalker::newInstance(MM_ParallelGlobalGC *globalCollector, MM_Mark
  */
 void
 MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+{
+	walkChunksParallel(env, function, NULL, userData, NULL, walkFlags);
+}
+
+/**
+ * Walk this thread's share of the heap chunks, applying either the plain or the accumulating object function.
+ */
+void
+MM_ParallelHeapWalker::walkChunksParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, MM_HeapWalkerObjectAccumulateFunc accumulateFunction, void *userData, void *accumulator, uintptr_t walkFlags)
 {
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Entry(env->getLanguageVMThread());
 	MM_GCExtensionsBase *extensions = env->getExtensions();
@@ -128,7 +186,11 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
 			omrobjectptr_t object = NULL;
 			while ((object = objectHeapIterator.nextObject()) != NULL) {
-				function(omrVMThread, region, object, userData);
+				if (NULL != accumulateFunction) {
+					accumulateFunction(omrVMThread, region, object, userData, accumulator);
+				} else {
+					function(omrVMThread, region, object, userData);
+				}
 				objectsWalked += 1;
 			}
 		}
@@ -158,6 +220,47 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * Walk through all live objects of the heap on the GC threads, giving each thread its own accumulator,
+ * then merge the accumulators on the calling thread.
+ */
+bool
+MM_ParallelHeapWalker::allObjectsDoAccumulate(MM_EnvironmentBase *env, MM_HeapWalkerObjectAccumulateFunc function, MM_HeapWalkerAccumulatorMergeFunc merge, void *userData, uintptr_t accumulatorSize, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+	uintptr_t accumulatorStride = MM_Math::roundToCeiling(CACHE_LINE_SIZE, OMR_MAX(accumulatorSize, sizeof(uintptr_t)));
+	uintptr_t storageSize = (threadCountMaximum * accumulatorStride) + (threadCountMaximum * sizeof(bool));
+
+	/* over allocate by a cache line so the first accumulator, and with it every other one, starts on a line boundary */
+	void *storage = extensions->getForge()->allocate(storageSize + CACHE_LINE_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == storage) {
+		return false;
+	}
+	uint8_t *accumulators = (uint8_t *)MM_Math::roundToCeiling(CACHE_LINE_SIZE, (uintptr_t)storage);
+	memset(accumulators, 0, storageSize);
+	bool *participated = (bool *)(accumulators + (threadCountMaximum * accumulatorStride));
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+	}
+
+	MM_ParallelObjectAccumulateTask accumulateTask(env, this, function, userData, walkFlags, accumulators, accumulatorStride, participated);
+	extensions->dispatcher->run(env, &accumulateTask);
+
+	/* all workers are done; merge in worker order so the result does not depend on scheduling */
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	for (uintptr_t i = 0; i < threadCountMaximum; i++) {
+		if (participated[i]) {
+			merge(omrVMThread, userData, accumulators + (i * accumulatorStride));
+		}
+	}
+
+	extensions->getForge()->free(storage);
+	return true;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +269,14 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * Walks this thread's chunks of the heap with the thread's own accumulator
+ */
+void
+MM_ParallelObjectAccumulateTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	_participated[workerID] = true;
+	_heapWalker->walkChunksParallel(env, NULL, _function, _userData, _accumulators + (workerID * _accumulatorStride), _walkFlags);
+}
@@ -32,6 +32,17 @@ class MM_EnvironmentBase;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/**
+ * Object callback for an accumulating parallel walk.
+ * The last argument is the calling thread's private, zero initialized accumulator.
+ */
+typedef void (*MM_HeapWalkerObjectAccumulateFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t, void *, void *);
+/**
+ * Fold one thread's accumulator into the result of an accumulating parallel walk.
+ * Called on a single thread, once for each thread that took part in the walk, in worker order.
+ */
+typedef void (*MM_HeapWalkerAccumulatorMergeFunc)(OMR_VMThread *, void *, void *);
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -47,6 +58,10 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Walk this thread's share of the heap chunks, applying function, or accumulateFunction with the thread's accumulator.
+	 */
+	void walkChunksParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, MM_HeapWalkerObjectAccumulateFunc accumulateFunction, void *userData, void *accumulator, uintptr_t walkFlags);
 protected:
 public:	
 	/**
@@ -54,6 +69,22 @@ public:
 	 */
 	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 
+	/**
+	 * Walk through all live objects of the heap on the GC threads, giving each thread its own accumulator.
+	 * The heap is made walkable first, and regions are split into chunks through the mark map when it is valid.
+	 * Once every thread has finished its chunks, merge is applied to each participating thread's accumulator
+	 * on a single thread, so neither callback needs to synchronize.
+	 *
+	 * @param[in] function called for every object with the calling thread's accumulator
+	 * @param[in] merge called once per participating thread to fold its accumulator into userData
+	 * @param[in] userData passed to both callbacks
+	 * @param[in] accumulatorSize size in bytes of each thread's accumulator
+	 * @param[in] walkFlags region type flags to restrict the walk to
+	 * @param[in] prepareHeapForWalk true if the heap must be made walkable before the walk
+	 * @return false if the accumulators could not be allocated and nothing was walked
+	 */
+	bool allObjectsDoAccumulate(MM_EnvironmentBase *env, MM_HeapWalkerObjectAccumulateFunc function, MM_HeapWalkerAccumulatorMergeFunc merge, void *userData, uintptr_t accumulatorSize, uintptr_t walkFlags, bool prepareHeapForWalk);
+
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
 	 * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -85,6 +116,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectAccumulateTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -37,6 +37,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACT_INCREMENT_SUB_AREA_LIMIT "-Xgc:compactIncrementSubAreaLimit="
+#define OMR_XGCCOMPACT_INCREMENT_SUB_AREA_LIMIT_LENGTH 34
+#define OMR_XGCCOMPACT_FORWARDING_SUMMARY "-Xgc:compactForwardingSummary"
+#define OMR_XGCCOMPACT_FORWARDING_SUMMARY_LENGTH 29
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,6 +52,34 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNCHRONOUS_LOGGING "-Xgc:asynchronousLogging"
+#define OMR_XGCASYNCHRONOUS_LOGGING_LENGTH 24
+#define OMR_XGCHEAP_RESIZE_TARGET_GC_PERCENTAGE "-Xgc:heapResizeTargetGCPercentage="
+#define OMR_XGCHEAP_RESIZE_TARGET_GC_PERCENTAGE_LENGTH 34
+#define OMR_XGCMARKING_ARRAY_SPLIT_THRESHOLD "-Xgc:markingArraySplitThreshold="
+#define OMR_XGCMARKING_ARRAY_SPLIT_THRESHOLD_LENGTH 32
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCONCURRENT_PACING "-Xgc:concurrentPacing"
+#define OMR_XGCCONCURRENT_PACING_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+#define OMR_XGCCONCURRENT_SWEEP_BACKGROUND "-Xgc:concurrentSweepBackground"
+#define OMR_XGCCONCURRENT_SWEEP_BACKGROUND_LENGTH 30
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#define OMR_XGCIDLE_HEAP_RELEASE "-Xgc:idleHeapRelease"
+#define OMR_XGCIDLE_HEAP_RELEASE_LENGTH 20
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+#define OMR_XGCBATCH_CLEAR_TLH_NON_TEMPORAL "-Xgc:batchClearTLHNonTemporal"
+#define OMR_XGCBATCH_CLEAR_TLH_NON_TEMPORAL_LENGTH 29
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+#define OMR_XGCTLH_ADAPTIVE_SIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH 23
+#define OMR_XGCSPLIT_FREE_LIST_TRY_LOCK "-Xgc:splitFreeListTryLock"
+#define OMR_XGCSPLIT_FREE_LIST_TRY_LOCK_LENGTH 25
+#define OMR_XGCWORK_PACKETS_LOCK_FREE "-Xgc:workPacketsLockFree"
+#define OMR_XGCWORK_PACKETS_LOCK_FREE_LENGTH 24
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -264,6 +296,14 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_INCREMENT_SUB_AREA_LIMIT, OMR_XGCCOMPACT_INCREMENT_SUB_AREA_LIMIT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCCOMPACT_INCREMENT_SUB_AREA_LIMIT_LENGTH, &extensions->compactIncrementSubAreaLimit)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_FORWARDING_SUMMARY, OMR_XGCCOMPACT_FORWARDING_SUMMARY_LENGTH)) {
+		extensions->compactForwardingSummary = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +316,55 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNCHRONOUS_LOGGING, OMR_XGCASYNCHRONOUS_LOGGING_LENGTH)) {
+		extensions->asynchronousLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_RESIZE_TARGET_GC_PERCENTAGE, OMR_XGCHEAP_RESIZE_TARGET_GC_PERCENTAGE_LENGTH)) {
+		uintptr_t targetGCPercentage = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_RESIZE_TARGET_GC_PERCENTAGE_LENGTH, &targetGCPercentage)) || (0 == targetGCPercentage) || (100 <= targetGCPercentage)) {
+			result = false;
+		} else {
+			/* a GC time target selects the cost model resize policy */
+			extensions->heapResizePolicy = MM_GCExtensionsBase::HEAP_RESIZE_POLICY_GC_COST;
+			extensions->heapResizeTargetGCPercentage = targetGCPercentage;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCMARKING_ARRAY_SPLIT_THRESHOLD, OMR_XGCMARKING_ARRAY_SPLIT_THRESHOLD_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCMARKING_ARRAY_SPLIT_THRESHOLD_LENGTH, &extensions->markingArraySplitThreshold)) {
+			result = false;
+		}
+	}
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_PACING, OMR_XGCCONCURRENT_PACING_LENGTH)) {
+		extensions->concurrentPacing = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SWEEP_BACKGROUND, OMR_XGCCONCURRENT_SWEEP_BACKGROUND_LENGTH)) {
+		extensions->concurrentSweepBackground = true;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	else if (0 == strncmp(option, OMR_XGCIDLE_HEAP_RELEASE, OMR_XGCIDLE_HEAP_RELEASE_LENGTH)) {
+		extensions->idleHeapRelease = true;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	else if (0 == strncmp(option, OMR_XGCBATCH_CLEAR_TLH_NON_TEMPORAL, OMR_XGCBATCH_CLEAR_TLH_NON_TEMPORAL_LENGTH)) {
+		/* non-temporal stores only apply to TLHs that are batch cleared */
+		extensions->batchClearTLH = 1;
+		extensions->batchClearTLHNonTemporal = true;
+	}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_SIZING, OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSPLIT_FREE_LIST_TRY_LOCK, OMR_XGCSPLIT_FREE_LIST_TRY_LOCK_LENGTH)) {
+		extensions->splitFreeListTryLock = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORK_PACKETS_LOCK_FREE, OMR_XGCWORK_PACKETS_LOCK_FREE_LENGTH)) {
+		extensions->workPacketsLockFree = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
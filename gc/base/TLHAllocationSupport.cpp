@@ -120,6 +120,8 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	/* seed the estimate so that the first adaptive refresh asks for the initial size again */
+	_usedBytesAverage = extensions->tlhInitialSize / 2;
 }
 
 /**
@@ -143,6 +145,8 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	setAllZeroes();
 
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	/* decay the estimate across the collection as well, so a thread that stays idle keeps shrinking its TLHs */
+	_usedBytesAverage /= 2;
 }
 
 /**
@@ -175,6 +179,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
+	if (NULL != getRealTop()) {
+		updateUsedBytesAverage(usedSize);
+		if (extensions->tlhAdaptiveSizing) {
+			/* size the TLH about to be allocated from the one just retired, not from the one before it */
+			setRefreshSize(getAdaptiveRefreshSize(extensions));
+		}
+	}
 
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
@@ -243,9 +254,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 			if (_zeroTLH) {
 				if (0 != extensions->batchClearTLH) {
-					void *base = getBase();
-					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					batchClear(env, getBase(), getTop());
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -285,7 +294,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -324,6 +333,15 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 		allocDescription->setObjectFlags(getObjectFlags());
 		allocDescription->setMemorySubSpace((MM_MemorySubSpace *)_tlh->memorySubSpace);
 		allocDescription->completedFromTlh();
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		/* lines beyond the window were zeroed past the cache; start pulling them in before allocation reaches them */
+		if (_zeroTLH && env->getExtensions()->batchClearTLHNonTemporal) {
+			uintptr_t prefetchAddress = (uintptr_t)getAlloc() + env->getExtensions()->batchClearTLHPrefetchWindow;
+			if (prefetchAddress < (uintptr_t)getTop()) {
+				OMR_GC_PREFETCH_WRITE(prefetchAddress);
+			}
+		}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	}
 
 	return memPtr;
@@ -383,6 +401,23 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 #endif /* OMR_GC_TLH_PREFETCH_FTA */
 }
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+void
+MM_TLHAllocationSupport::batchClear(MM_EnvironmentBase *env, void *base, void *top)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+
+	if (extensions->batchClearTLHNonTemporal) {
+		uintptr_t cachedSize = OMR_MIN(size, extensions->batchClearTLHPrefetchWindow);
+		OMRZeroMemory(base, cachedSize);
+		OMRZeroMemoryNonTemporal((void *)((uintptr_t)base + cachedSize), size - cachedSize);
+	} else {
+		OMRZeroMemory(base, size);
+	}
+}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 void
 MM_TLHAllocationSupport::updateFrequentObjectsStats(MM_EnvironmentBase *env)
 {
@@ -38,6 +38,7 @@
 #include "EnvironmentBase.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LanguageThreadLocalHeap.hpp"
+#include "Math.hpp"
 #if defined(OMR_GC_OBJECT_MAP)
 #include "ObjectMap.hpp"
 #endif /* defined(OMR_GC_OBJECT_MAP) */
@@ -83,6 +84,8 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	uintptr_t _usedBytesAverage; /**< decayed average of the bytes this thread consumed from each TLH before refreshing it (tlhAdaptiveSizing) */
+
 public:
 protected:
 private:
@@ -90,6 +93,36 @@ private:
 
 	void flushCache(MM_EnvironmentBase *env);
 
+	/**
+	 * Fold the bytes consumed from the TLH being retired into the decayed per thread average.
+	 * Each new sample carries half the weight, so the estimate follows changes in allocation rate within a few refreshes.
+	 *
+	 * @param[in] usedSize bytes allocated from the TLH being retired
+	 */
+	MMINLINE void updateUsedBytesAverage(uintptr_t usedSize)
+	{
+		_usedBytesAverage = (_usedBytesAverage >> 1) + (usedSize >> 1);
+	}
+
+	/**
+	 * Size the next TLH from the decayed average of bytes consumed per TLH.
+	 * A thread that fills its TLHs grows its refresh size by half on every refresh (the average moves halfway
+	 * towards a full TLH, and the next TLH is twice the average), while a thread that abandons
+	 * mostly empty TLHs shrinks towards the minimum rather than holding on to large unused remainders.
+	 *
+	 * @return object aligned refresh size between tlhMinimumSize and tlhMaximumSize
+	 */
+	MMINLINE uintptr_t getAdaptiveRefreshSize(MM_GCExtensionsBase *extensions)
+	{
+		uintptr_t refreshSize = MM_Math::roundToCeiling(extensions->getObjectAlignmentInBytes(), _usedBytesAverage << 1);
+		if (refreshSize < extensions->tlhMinimumSize) {
+			refreshSize = extensions->tlhMinimumSize;
+		} else if (refreshSize > extensions->tlhMaximumSize) {
+			refreshSize = extensions->tlhMaximumSize;
+		}
+		return refreshSize;
+	}
+
 	MMINLINE void *getBase() { return (void *)_tlh->heapBase; };
 	MMINLINE void setBase(void *basePtr) { _tlh->heapBase = (uint8_t *)basePtr; };
 
@@ -148,6 +181,15 @@ private:
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/**
+	 * Zero a freshly allocated TLH ahead of the allocations that will be made from it.
+	 * With batchClearTLHNonTemporal the first batchClearTLHPrefetchWindow bytes, where allocation starts
+	 * immediately, are zeroed through the cache and the remainder is streamed past it.
+	 */
+	void batchClear(MM_EnvironmentBase *env, void *base, void *top);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	MMINLINE void wipeTLH(MM_EnvironmentBase *env)
 	{
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
@@ -191,7 +233,8 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_usedBytesAverage(0)
 	{};
 
 	/*
@@ -143,6 +143,16 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	/* If -Xgcworkpackets was specified  we don't allow later allocation of more packets */
 	_maxPackets = (0 != _extensions->workpacketCount) ? initialPacketCount : initialPacketCount * _increaseFactor;
+
+	_lockFreeEmptyPackets = _extensions->workPacketsLockFree;
+	if (_lockFreeEmptyPackets) {
+		/* the lock-free stack identifies packets by a 32-bit index so that the other half of its head can hold the ABA tag */
+		Assert_MM_true(_maxPackets <= U_32_MAX);
+		_packetTable = (MM_Packet **)env->getForge()->allocate(_maxPackets * sizeof(MM_Packet *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (!_emptyPacketStack.initialize(env, _packetTable)) {
+			return false;
+		}
+	}
 	
 	/* NULL out the packetsBlocks array to begin with */
 	for(uintptr_t i = 0; i < _maxPacketsBlocks; i++) {    
@@ -194,6 +204,11 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		if (_lockFreeEmptyPackets) {
+			uintptr_t packetIndex = _activePackets + i + 1;
+			currentPtr->setPacketIndex(packetIndex);
+			_packetTable[packetIndex - 1] = currentPtr;
+		}
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -204,8 +219,11 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 		}
 	}
 
-	
-	_emptyPacketList.pushList(headPtr, tailPtr, _packetsPerBlock);
+	if (_lockFreeEmptyPackets) {
+		_emptyPacketStack.pushList(headPtr, tailPtr, _packetsPerBlock);
+	} else {
+		_emptyPacketList.pushList(headPtr, tailPtr, _packetsPerBlock);
+	}
 
 	_packetsBlocksTop++;
 	_activePackets += _packetsPerBlock;
@@ -231,6 +249,11 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		}
 	}
 
+	if (NULL != _packetTable) {
+		env->getForge()->free(_packetTable);
+		_packetTable = NULL;
+	}
+
 	if (NULL != _inputListMonitor) {
 		omrthread_monitor_destroy(_inputListMonitor);
 		_inputListMonitor = NULL;
@@ -289,7 +312,7 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 	/* Do sanity check on ctrs */	
 	assume0(_deferredFullPacketList.getCount() == 0);
 	assume0(_deferredPacketList.getCount() == 0);
-	assume0(_emptyPacketList.getCount() == _activePackets);
+	assume0(getEmptyPacketCount() == _activePackets);
 
 	clearOverflowFlag();
 }
@@ -360,7 +383,7 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 	MM_Packet *overflowPacket;
 
 	while(!_overflowHandler->isEmpty()) {
-		if(NULL != (overflowPacket = getPacket(env, &_emptyPacketList))) {
+		if(NULL != (overflowPacket = getEmptyPacket(env))) {
 			
 			_overflowHandler->fillFromOverflow(env, overflowPacket);
 			
@@ -390,7 +413,7 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		return NULL;
 	}
 
-	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
+	if((!_nonEmptyPacketList.isEmpty()) && (getEmptyPacketCount() < (_activePackets >> 2))) {
 		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
 			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
 				packet = getPacket(env, &_fullPacketList);
@@ -508,7 +531,7 @@ MM_WorkPackets::getOutputPacket(MM_EnvironmentBase *env)
 	MM_Packet *outputPacket = NULL;
 
 	/* Check the free list */
-	outputPacket = getPacket(env, &_emptyPacketList);
+	outputPacket = getEmptyPacket(env);
 	if(NULL != outputPacket) {
 		return outputPacket;
 	}
@@ -550,14 +573,14 @@ MM_WorkPackets::getPacketByAdddingWorkPacketBlock(MM_EnvironmentBase *env)
 	/* Check to see if there are any packets on the empty packetlist since another thread may have allocated
 	 * another WorkPacket block while this thread was attempting to take control of the allocatingPackets field
 	 */
-	packet = getPacket(env, &_emptyPacketList);
+	packet = getEmptyPacket(env);
 	if(NULL == packet) {
 		/* Since the current thread now has control of the allocatingPackets field and there are no packets
 		 * on the emptyPacketList attempt to initialize another workPackets block
 		 */
 		if(initWorkPacketsBlock(env)) {
 			/* Successfully initialized another workpacket block so get a packet off of the emptyPacketList */
-			packet = getPacket(env, &_emptyPacketList);
+			packet = getEmptyPacket(env);
 		}
 	}
 
@@ -591,7 +614,7 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 		
 		omrthread_monitor_exit(_inputListMonitor);
 	} else {
-		packet = getPacket(env, &_emptyPacketList);
+		packet = getEmptyPacket(env);
 		if(NULL == packet) {
 			packet = getLeastFullPacket(env, 2);
 		}
@@ -696,6 +719,44 @@ MM_WorkPackets::getPacket(MM_EnvironmentBase *env, MM_PacketList *list)
 	return packet;
 }
 
+/**
+ * Get a packet from the shared pool of empty packets
+ * 
+ * @return pointer to a packet, or NULL
+ */
+MM_Packet *
+MM_WorkPackets::getEmptyPacket(MM_EnvironmentBase *env)
+{
+	if (!_lockFreeEmptyPackets) {
+		return getPacket(env, &_emptyPacketList);
+	}
+
+	MM_Packet *packet = _emptyPacketStack.pop(env);
+	if (NULL != packet) {
+		packet->setOwner(env);
+	}
+	return packet;
+}
+
+bool
+MM_WorkPackets::cacheEmptyPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	/* leave enough empty packets in the shared pool for threads that have nothing cached */
+	if (_lockFreeEmptyPackets && (getSharedEmptyPacketCount() > (_activePackets >> 2))) {
+		packet->clearOwner();
+		MM_AtomicOperations::add(&_cachedPacketCount, 1);
+		return true;
+	}
+	return false;
+}
+
+void
+MM_WorkPackets::uncacheEmptyPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	MM_AtomicOperations::subtract(&_cachedPacketCount, 1);
+	packet->setOwner(env);
+}
+
 /**
  * Put a packet back to the correct list
  * 
@@ -710,8 +771,13 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 
     /* Empty packet */
 	if(freeSlots == _slotsInPacket) {
-		list = &_emptyPacketList;
 		packet->clearOwner();
+		if (_lockFreeEmptyPackets) {
+			/* no waiting thread is interested in an empty packet */
+			_emptyPacketStack.push(env, packet);
+			return;
+		}
+		list = &_emptyPacketList;
 				
 	/* Full packet */
 	} else if(freeSlots == 0) {
@@ -777,7 +843,7 @@ MM_WorkPackets::getDeferredPacket(MM_EnvironmentBase *env)
 	MM_Packet *packet;
  	
 	if(NULL == (packet = getPacket(env, &_deferredPacketList))) {
-		packet = getPacket(env, &_emptyPacketList);
+		packet = getEmptyPacket(env);
 	}
 	
 	return packet;
@@ -37,6 +37,7 @@
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
 #include "PacketList.hpp"
+#include "PacketStack.hpp"
 #include "WorkPacketOverflow.hpp"
 
 class MM_EnvironmentBase;
@@ -79,6 +80,10 @@ protected:
 	MM_PacketList _nonEmptyPacketList;  /**< List for non empty packets */
 	MM_PacketList _deferredPacketList;  /**< List for deferred packets */
 	MM_PacketList _deferredFullPacketList;  /**< List for full deferred packets */
+	MM_PacketStack _emptyPacketStack;  /**< Lock-free stack used instead of _emptyPacketList when workPacketsLockFree is enabled */
+	MM_Packet **_packetTable;  /**< Maps packet indices to packets for _emptyPacketStack (NULL unless workPacketsLockFree is enabled) */
+	bool _lockFreeEmptyPackets;  /**< true if empty packets are kept on _emptyPacketStack and may be cached by MM_WorkStack */
+	volatile uintptr_t _cachedPacketCount;  /**< Number of empty packets held in per-thread MM_WorkStack caches */
 	
 	OMRPortLibrary *_portLibrary;
 
@@ -94,6 +99,21 @@ protected:
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
 
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
+
+	/**
+	 * Get a packet from the shared pool of empty packets.
+	 * @return pointer to a packet, or NULL if there are no empty packets
+	 */
+	MM_Packet *getEmptyPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Number of empty packets in the shared pool (not counting packets cached by threads).
+	 */
+	MMINLINE uintptr_t
+	getSharedEmptyPacketCount()
+	{
+		return _lockFreeEmptyPackets ? _emptyPacketStack.getCount() : _emptyPacketList.getCount();
+	}
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
 	virtual bool initialize(MM_EnvironmentBase *env);
@@ -117,6 +137,22 @@ public:
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
+	/**
+	 * Called by a thread that wants to keep an empty packet in its private cache rather than
+	 * returning it to the shared pool. Caching is refused when lock-free packets are disabled
+	 * or when the shared pool is running low.
+	 * @param packet[in] the empty packet
+	 * @return true if the caller may keep the packet
+	 */
+	bool cacheEmptyPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Called by a thread that takes a packet out of its private cache for use as an output packet
+	 * (or to return it to the shared pool).
+	 * @param packet[in] the packet taken from the cache
+	 */
+	void uncacheEmptyPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
@@ -131,7 +167,7 @@ public:
 	 */
 	MMINLINE bool isAllPacketsEmpty()
 	{
-		return(_emptyPacketList.getCount() == _activePackets);
+		return(getEmptyPacketCount() == _activePackets);
 	};
 	
 	/**
@@ -139,7 +175,7 @@ public:
 	 */
 	MMINLINE bool tracingExhausted()
 	{
-		return(_emptyPacketList.getCount() + _deferredPacketList.getCount() + _deferredFullPacketList.getCount() == _activePackets);
+		return(getEmptyPacketCount() + _deferredPacketList.getCount() + _deferredFullPacketList.getCount() == _activePackets);
 	};
 	
 	MMINLINE uintptr_t getThreadWaitCount() {
@@ -151,7 +187,7 @@ public:
 	 */
 	MMINLINE uintptr_t getNonEmptyPacketCount()
 	{
-		return(_activePackets - _emptyPacketList.getCount());
+		return(_activePackets - getEmptyPacketCount());
 	};
 	
 	/** Returns number of active packets
@@ -166,7 +202,7 @@ public:
 	 */
 	MMINLINE uintptr_t getEmptyPacketCount()
 	{
-		return(_emptyPacketList.getCount());
+		return(getSharedEmptyPacketCount() + _cachedPacketCount);
 	};
 
 	/**
@@ -232,6 +268,10 @@ public:
 		_nonEmptyPacketList(env),
 		_deferredPacketList(env),
 		_deferredFullPacketList(env),
+		_emptyPacketStack(),
+		_packetTable(NULL),
+		_lockFreeEmptyPackets(false),
+		_cachedPacketCount(0),
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
@@ -46,6 +46,7 @@ MM_WorkStack::reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
 	Assert_MM_true(NULL == _inputPacket);
 	Assert_MM_true(NULL == _outputPacket);
 	Assert_MM_true(NULL == _deferredPacket);
+	Assert_MM_true(0 == _packetCacheCount);
 }
 
 void
@@ -57,6 +58,7 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 		Assert_MM_true(NULL == _inputPacket);
 		Assert_MM_true(NULL == _outputPacket);
 		Assert_MM_true(NULL == _deferredPacket);
+		Assert_MM_true(0 == _packetCacheCount);
 	} else {
 		Assert_MM_true(_workPackets == workPackets);
 	}
@@ -72,8 +74,7 @@ void
 MM_WorkStack::flush(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 	if(NULL != _outputPacket) {
 		_workPackets->putPacket(env, _outputPacket);
@@ -83,6 +84,12 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	while (0 < _packetCacheCount) {
+		_packetCacheCount -= 1;
+		MM_Packet *packet = _packetCache[_packetCacheCount];
+		_workPackets->uncacheEmptyPacket(env, packet);
+		_workPackets->putPacket(env, packet);
+	}
 	_workPackets = NULL;
 }
 
@@ -135,8 +142,7 @@ MM_WorkStack::popNoWaitFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for resuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -192,8 +198,7 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for reuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -222,6 +227,33 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 	return NULL;
 }
 
+void
+MM_WorkStack::releaseInputPacket(MM_EnvironmentBase *env)
+{
+	if ((_packetCacheCount < _packetCacheSize) && _inputPacket->isEmpty() && _workPackets->cacheEmptyPacket(env, _inputPacket)) {
+		_packetCache[_packetCacheCount] = _inputPacket;
+		_packetCacheCount += 1;
+	} else {
+		_workPackets->putPacket(env, _inputPacket);
+	}
+	_inputPacket = NULL;
+}
+
+MM_Packet *
+MM_WorkStack::acquireOutputPacket(MM_EnvironmentBase *env)
+{
+	if (0 < _packetCacheCount) {
+		_packetCacheCount -= 1;
+		MM_Packet *packet = _packetCache[_packetCacheCount];
+		_workPackets->uncacheEmptyPacket(env, packet);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsCached += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
+	return _workPackets->getOutputPacket(env);
+}
+
 void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
 	if(_outputPacket) {
@@ -230,7 +262,7 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element, OVERFLOW_TYPE_WORKSTACK);
 	} else {
@@ -248,7 +280,7 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *ele
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element1, OVERFLOW_TYPE_WORKSTACK);
 		_workPackets->overflowItem(env, element2, OVERFLOW_TYPE_WORKSTACK);
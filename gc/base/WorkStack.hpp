@@ -52,6 +52,12 @@ private:
 	
 	uintptr_t 		_pushCount;
 
+	enum {
+		_packetCacheSize = 4 /**< maximum number of empty packets a thread keeps for itself */
+	};
+	MM_Packet *_packetCache[_packetCacheSize]; /**< empty packets kept by this thread for reuse as output packets (workPacketsLockFree only) */
+	uintptr_t _packetCacheCount; /**< number of entries in _packetCache */
+
 /* function members */
 private:
 	/**
@@ -85,6 +91,19 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Give up the used up input packet, keeping it in the private packet cache if the work packets allow it.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void releaseInputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Get a new output packet, from the private packet cache if possible.
+	 * @param env[in] The thread which owns the work stack
+	 * @return the packet, or NULL if none is available
+	 */
+	MM_Packet *acquireOutputPacket(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -231,7 +250,8 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_packetCacheCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -190,6 +190,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case IDLE_CONTRACT:
+		return "release memory while idle";
 	default:
 		return "unknown";
 	}
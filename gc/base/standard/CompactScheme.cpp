@@ -101,12 +101,7 @@ makeMask(intptr_t maskSize)
 MMINLINE intptr_t
 countBits(uintptr_t x)
 {
-    intptr_t count = 0;
-    while (x) {
-        count++;
-        x &= x-1;
-    }
-    return count;
+	return (intptr_t)MM_Bits::populationCount(x);
 }
 
 /************************************************************
@@ -164,6 +159,25 @@ enum {
 	invalidValue = maxValue - 1,
 };
 
+/************************************************************
+ *
+ * Forwarding summary layout
+ *
+ * One row of summaryGroups bytes per page, so a cache line holds the
+ * rows of several consecutive pages.  The compressed mark bits of a page
+ * are split into summaryGroups groups of summaryGroupBits bits and byte g
+ * holds the distance (in UDATAs) of the first relocated object of group g
+ * from the page's forwardingPtr.  A lookup then walks at most
+ * summaryGroupBits - 1 relocated objects instead of every preceding
+ * object on the page.
+ */
+enum {
+	summaryGroups = 8,
+	summaryGroupBits = (maxOffset + summaryGroups - 1) / summaryGroups,
+	/* Used when object growth due to hash pushes the distance out of range */
+	summaryInvalidValue = 0xFF,
+};
+
 class CompactTableEntry {
 private:
 	uintptr_t _addr;
@@ -226,6 +240,16 @@ public:
 		return countBits(_bits & makeMask(offset));
 	}
 
+	/**
+	 * Answer the number of objects which precede offset within its forwarding summary group.
+	 */
+	intptr_t
+	getGroupOrdinal(intptr_t offset) const
+	{
+		intptr_t groupStart = (offset / summaryGroupBits) * summaryGroupBits;
+		return countBits(_bits & makeMask(offset) & ~makeMask(groupStart));
+	}
+
 	void
 	setHint(intptr_t index, intptr_t value)
 	{
@@ -286,6 +310,10 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _forwardingSummary) {
+		env->getForge()->free(_forwardingSummary);
+		_forwardingSummary = NULL;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -369,6 +397,14 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+
+	if (_extensions->compactForwardingSummary && (NULL == _forwardingSummary)) {
+		/* Sized for the fully expanded heap so the summary survives heap resizing. Running without
+		 * the summary is always correct, so a failed allocation only disables it.
+		 */
+		uintptr_t pageCount = (_heap->getMaximumPhysicalRange() / sizeof_page) + 1;
+		_forwardingSummary = (uint8_t *)env->getForge()->allocate(pageCount * summaryGroups, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	}
 	_delegate.mainSetupForGC(env);
 }
 
@@ -419,6 +455,13 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		GC_HeapRegionIteratorStandard regionIterator(_rootManager);
 		uintptr_t i = 0;
+		/* An incremental compaction evacuates one contiguous window of sub areas starting at the cursor; every other
+		 * sub area is fixup_only. The window never wraps, so the forwarding range [_compactFrom, _compactTo) never
+		 * covers a fixup_only sub area whose mark bits are still needed.
+		 */
+		uintptr_t subAreaCount = 0;
+		uintptr_t windowStart = _incrementCursor;
+		uintptr_t windowEnd = windowStart + _incrementSubAreaLimit;
 		while(NULL != (region = regionIterator.nextRegion())) {
 			if (!region->isCommitted() || (0 == region->getSize())) {
 				continue;
@@ -427,7 +470,6 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			void *highAddress = region->getHighAddress();
 			uintptr_t areaSize = region->getSize();
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
-			intptr_t state = SubAreaEntry::init;
 
 			if (singleThreaded) {
 				size = areaSize;
@@ -439,6 +481,12 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 
 			for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
 				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
+				uintptr_t state = SubAreaEntry::init;
+
+				if ((0 != _incrementSubAreaLimit) && ((subAreaCount < windowStart) || (subAreaCount >= windowEnd))) {
+					state = SubAreaEntry::fixup_only;
+				}
+				subAreaCount += 1;
 
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
@@ -453,6 +501,11 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 		}
 		_subAreaTable[i].state = SubAreaEntry::end_heap;
 
+		if (0 != _incrementSubAreaLimit) {
+			/* Restart from the bottom of the heap once the window has covered it (or if the heap has shrunk) */
+			_incrementCursor = (windowEnd < subAreaCount) ? windowEnd : 0;
+		}
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -563,6 +616,9 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* An aggressive compaction is trying to satisfy an allocate so it always evacuates the whole heap */
+		_incrementSubAreaLimit = aggressive ? 0 : _extensions->compactIncrementSubAreaLimit;
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -698,10 +754,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeSize = 0;
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
+			} else if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Nothing was moved out of the sub area, so its free space is still described by the mark map */
+				addFreeEntriesFixupOnly(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject, currentFreeBase);
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -727,6 +784,30 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::addFreeEntriesFixupOnly(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t firstObject, omrobjectptr_t finish, void *&currentFreeBase)
+{
+	/* Objects on the page of finish belong to the next sub area */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t scanPtr = firstObject;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((NULL == currentFreeBase) && (objectPtr > scanPtr)) {
+			currentFreeBase = (void *)scanPtr;
+		}
+		if (NULL != currentFreeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+			currentFreeBase = NULL;
+		}
+		scanPtr = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	if ((NULL == currentFreeBase) && (scanPtr < finish)) {
+		currentFreeBase = (void *)scanPtr;
+	}
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1148,6 +1229,16 @@ MM_CompactScheme::saveForwardingPtr(CompactTableEntry &entry, omrobjectptr_t obj
 
 	uintptr_t offset = compressedPageOffset(objectPtr);
 	assume0(offset*sizeof(J9Object) <= sizeof_page);
+
+	if ((NULL != _forwardingSummary) && (0 == entry.getGroupOrdinal(offset))) {
+		/* First relocated object of its group. Pages are never shared between threads so the row needs no synchronization. */
+		uintptr_t distance = ((uintptr_t)forwardingPtr - (uintptr_t)entry.getAddr()) / sizeof(uintptr_t);
+		if (distance >= summaryInvalidValue) {
+			distance = summaryInvalidValue;
+		}
+		_forwardingSummary[(page * summaryGroups) + (offset / summaryGroupBits)] = (uint8_t)distance;
+	}
+
 	entry.setBit(offset);
 
 	if (counter >= 1 && counter <= maxHints) {
@@ -1310,6 +1401,19 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return forwardingPtr;
 	}
 
+	if ((n > maxHints) && (NULL != _forwardingSummary)) {
+		uintptr_t distance = _forwardingSummary[(index * summaryGroups) + (offset / summaryGroupBits)];
+		if (summaryInvalidValue != distance) {
+			forwardingPtr = (omrobjectptr_t)((uintptr_t)forwardingPtr + (distance * sizeof(uintptr_t)));
+			for (intptr_t i = _compactTable[index].getGroupOrdinal(offset); i > 0; i--) {
+				size_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardingPtr);
+				forwardingPtr = (omrobjectptr_t)((uintptr_t)forwardingPtr + size);
+			}
+			MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+			return forwardingPtr;
+		}
+	}
+
 	if (n <= maxHints) {
 		Assert_MM_true((n >= 1) && (n <= maxHints));
 		intptr_t hint = _compactTable[index].getHint(n-1);
@@ -1419,7 +1523,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1484,7 +1588,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
@@ -137,6 +137,9 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	uintptr_t              _incrementSubAreaLimit; /**< Number of sub areas evacuated by the current compaction (0 if the whole heap is evacuated) */
+	uintptr_t              _incrementCursor; /**< Index of the first sub area evacuated by the next incremental compaction */
+	uint8_t                *_forwardingSummary; /**< Per page distances of the first relocated object of each mark bit group (NULL if disabled) */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -220,6 +223,25 @@ protected:
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Add the gaps between the marked objects of a fixup_only sub area to the free list.
+	 * A gap that runs to the end of the sub area is left open in currentFreeBase so it
+	 * can be coalesced with free space at the start of the next sub area.
+	 *
+	 * @param env[in] the current thread
+	 * @param memorySubSpace[in] the subspace which owns the sub area
+	 * @param poolState[in/out] the free list being rebuilt
+	 * @param firstObject[in] the first object in the sub area
+	 * @param finish[in] the first object in the next sub area
+	 * @param currentFreeBase[in/out] the start of the free run carried between sub areas, or NULL
+	 */
+	void addFreeEntriesFixupOnly(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t firstObject,
+					omrobjectptr_t finish,
+					void *&currentFreeBase);
+
 	void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -335,6 +357,9 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _incrementSubAreaLimit(0)
+		, _incrementCursor(0)
+		, _forwardingSummary(NULL)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
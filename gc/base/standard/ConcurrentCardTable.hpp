@@ -31,6 +31,7 @@
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 
 /**
@@ -66,6 +67,7 @@
 #define FINAL_CARD_CLEAN_MASK (CARD_DIRTY)
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
+#define CARD_SCAN_BLOCK_SIZE 64 /* cards tested together when skipping clean runs of the card table */
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
  
 /**
@@ -231,7 +233,7 @@ protected:
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
 	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
-	
+
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
 	virtual void prepareCardsForCleaning(MM_EnvironmentBase *env);
@@ -286,6 +288,50 @@ protected:
 	}
 
 public:
+	/**
+	 * Skip over a run of clean card table slots.
+	 * Tests a block of CARD_SCAN_BLOCK_SIZE cards per iteration by OR-ing its slots together and testing the
+	 * result once, then finishes off one slot at a time.
+	 * This relies on a clean card being 0, so a block is clean exactly when the OR of its slots is 0.
+	 *
+	 * @param nextSlot first slot to test
+	 * @param lastSlot slot to stop at (exclusive)
+	 * @return first slot holding a card that is not clean, or lastSlot
+	 */
+	MMINLINE static uintptr_t *skipCleanSlots(uintptr_t *nextSlot, uintptr_t *lastSlot)
+	{
+		const uintptr_t slotsPerBlock = CARD_SCAN_BLOCK_SIZE / sizeof(uintptr_t);
+
+		while ((uintptr_t)(lastSlot - nextSlot) >= slotsPerBlock) {
+			uintptr_t blockCards = 0;
+			for (uintptr_t i = 0; i < slotsPerBlock; i++) {
+				blockCards |= nextSlot[i];
+			}
+			if (SLOT_ALL_CLEAN != blockCards) {
+				break;
+			}
+			nextSlot += slotsPerBlock;
+		}
+		while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
+			nextSlot += 1;
+		}
+		return nextSlot;
+	}
+
+	/**
+	 * Skip the clean slots from a slot aligned card, stopping at the last slot boundary at or below endCard
+	 * so that no card past endCard is read. The cards of a partial slot at the end are left to the caller.
+	 *
+	 * @param firstCard slot aligned card to start at
+	 * @param endCard card to stop at (exclusive), need not be slot aligned
+	 * @return first card of the first slot holding a card that is not clean, or the last slot boundary at or below endCard
+	 */
+	MMINLINE static Card *skipCleanCards(Card *firstCard, Card *endCard)
+	{
+		uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)endCard);
+		return (Card *)skipCleanSlots((uintptr_t *)firstCard, lastSlot);
+	}
+
 	/**
 	 * Creates and returns a new instance of the card table.
 	 * @param[in] env The thread starting up the collector
@@ -359,15 +359,10 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentBase *env, Card
 					 */
 					if (((Card)CARD_CLEAN == *currentCard) &&
 						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
-						}
-						
 						/*
 						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
 						 */
-						currentCard= (Card *)nextSlot; 
+						currentCard = skipCleanCards(currentCard, endCard);
 
 						/* End of card table reached ? */
 						if (currentCard >= endCard) {
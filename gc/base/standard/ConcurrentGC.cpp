@@ -232,6 +232,28 @@ MM_ConcurrentGC::reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbor
 	);
 }
 
+void
+MM_ConcurrentGC::reportConcurrentPacing(MM_EnvironmentBase *env, ConcurrentPacingOutcome outcome, uintptr_t unfinishedWork, float exhaustionTime, float helperTraceTime)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_PACING(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_CONCURRENT_PACING,
+		(uintptr_t)outcome,
+		_pacingFreeAtExhausted,
+		unfinishedWork,
+		_pacingAllocationRate,
+		_pacingConHelperTraceRate,
+		exhaustionTime,
+		helperTraceTime,
+		_pacingKickoffFactor,
+		_stats.getKickoffThreshold()
+	);
+}
+
 void
 MM_ConcurrentGC::reportConcurrentHalted(MM_EnvironmentBase *env)
 {
@@ -606,6 +628,14 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 		_callback->registerCallback(env, signalThreadsToActivateWriteBarrierAsyncEventHandler, this);
 	}
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	if (_extensions->concurrentSweep && _extensions->concurrentSweepBackground) {
+		/* Background sweeping gives way to exclusive access and picks up again once it is released */
+		J9HookInterface** mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+		(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, OMR_GET_CALLSITE(), (void *)this);
+	}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
 	if (_conHelperThreads > 0) {
 		/* Get storage for concurrent helper thread table */
 		_conHelpersTable = (omrthread_t *)env->getForge()->allocate(_conHelperThreads * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
@@ -755,6 +785,13 @@ MM_ConcurrentGC::tearDown(MM_EnvironmentBase *env)
 		_callback = NULL;
 	}
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	if (_extensions->concurrentSweep && _extensions->concurrentSweepBackground) {
+		J9HookInterface** mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+		(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, (void *)this);
+	}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
 	/* ..and then tearDown our super class */
 	MM_ParallelGlobalGC::tearDown(env);
 }
@@ -1093,6 +1130,13 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 
 		env->acquireVMAccess();
 		request = getConHelperRequest(env);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (CONCURRENT_HELPER_SWEEP == request) {
+			conHelperSweep(env);
+			env->releaseVMAccess();
+			continue;
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 		if (CONCURRENT_HELPER_MARK != request) {
 			env->releaseVMAccess();
 			continue;
@@ -1290,8 +1334,14 @@ MM_ConcurrentGC::resumeConHelperThreads(MM_EnvironmentBase *env)
 	if (_conHelpersStarted > 0) {
 		omrthread_monitor_enter(_conHelpersActivationMonitor);
 		if (!env->isExclusiveAccessRequestWaiting()) {
-			if (CONCURRENT_HELPER_WAIT == _conHelpersRequest) {
+			/* Marking takes priority over any background sweeping still in progress */
+			if ((CONCURRENT_HELPER_WAIT == _conHelpersRequest) || (CONCURRENT_HELPER_SWEEP == _conHelpersRequest)) {
 				_conHelpersRequest = CONCURRENT_HELPER_MARK;
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+				if (_extensions->concurrentSweep) {
+					((MM_ConcurrentSweepScheme *)_sweepScheme)->setBackgroundSweepRequested(false);
+				}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 				omrthread_monitor_notify_all(_conHelpersActivationMonitor);
 			}
 		}
@@ -1327,6 +1377,15 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 		return;
 	}
 
+	/* Learn from how the cycle that just finished used its free memory before
+	 * the statistics it left behind are reset
+	 */
+	ConcurrentPacingOutcome pacingOutcome = CONCURRENT_PACING_NO_FEEDBACK;
+	uintptr_t unfinishedWork = 0;
+	if (_extensions->concurrentPacing) {
+		pacingOutcome = updatePacing(env, &unfinishedWork);
+	}
+
 	/* If _kickoffThreashold is 0
 	 *  then this is first time through so do initialisation,
 	 *  else heap size has changed
@@ -1458,6 +1517,26 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 					   (_traceTargetPass1 / _allocToTraceRateNormal) +
 					   (_traceTargetPass2 / (_allocToTraceRateNormal * _allocToTraceRateCardCleanPass2Boost));
 
+	/* With pacing the tracing part of the threshold is re-placed in time. Tracing at the tax rate alone
+	 * completes just as the free memory at kickoff runs out, so at the measured allocation rate that memory
+	 * lasts as long as marking may take. Concurrent helpers working alongside the tax shorten the marking
+	 * time, and the result is scaled by the feedback from previous cycles.
+	 */
+	float exhaustionTime = 0;
+	float helperTraceTime = 0;
+	if (_extensions->concurrentPacing) {
+		uintptr_t initThreshold = (uintptr_t)(_stats.getInitWorkRequired() / _allocToInitRate);
+		uintptr_t traceThreshold = kickoffThreshold - initThreshold;
+		if (0 < _pacingAllocationRate) {
+			exhaustionTime = (float)traceThreshold / _pacingAllocationRate;
+			if (0 < _pacingConHelperTraceRate) {
+				helperTraceTime = (float)(_traceTargetPass1 + _traceTargetPass2) / _pacingConHelperTraceRate;
+			}
+			traceThreshold = (uintptr_t)(getPacedMarkTime(exhaustionTime, helperTraceTime, _allocToTraceRateMaxFactor) * _pacingAllocationRate);
+		}
+		kickoffThreshold = (uintptr_t)((float)(initThreshold + traceThreshold) * _pacingKickoffFactor);
+	}
+
 	/* Determine card cleaning thresholds */
 	cardCleaningThreshold = ((uintptr_t)((float)kickoffThreshold / _cardCleaningThresholdFactor));
 
@@ -1498,6 +1577,14 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 							_stats.getCardCleaningThreshold());
 		omrtty_printf("               Init Work Required=\"%zu\" \n",
 							_stats.getInitWorkRequired());
+		if (_extensions->concurrentPacing) {
+			omrtty_printf("               Pacing: exhaustion time=\"%.1f\" helper trace time=\"%.1f\" KO factor=\"%.3f\" alloc rate=\"%.1f\" helper rate=\"%.1f\"\n",
+							exhaustionTime, helperTraceTime, _pacingKickoffFactor, _pacingAllocationRate, _pacingConHelperTraceRate);
+		}
+	}
+
+	if (_extensions->concurrentPacing) {
+		reportConcurrentPacing(env, pacingOutcome, unfinishedWork, exhaustionTime, helperTraceTime);
 	}
 
 	_initSetupDone = false;
@@ -1515,6 +1602,7 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	_maxAverageAlloc2TraceRate = 0;
     _lastFreeSize = LAST_FREE_SIZE_NEEDS_INITIALIZING;
 	_lastTotalTraced = 0;
+	_pacingFreeAtExhausted = 0;
 
 	Trc_MM_ConcurrentGC_tuneToHeap_Exit2(env->getLanguageVMThread(), _stats.getTraceSizeTarget(), _stats.getInitWorkRequired(), _stats.getKickoffThreshold());
 }
@@ -1544,6 +1632,90 @@ MM_ConcurrentGC::adjustTraceTarget()
 	_stats.setTraceSizeTarget(newTraceTarget);
 }
 
+/**
+ * Pacing controller feedback step.
+ * A cycle which ran out of tracing work with much more free memory left than the
+ * kickoff buffer was started too early, so the kickoff threshold is scaled down in
+ * proportion to the excess. A cycle which was collected before tracing completed
+ * was started too late, so the threshold is scaled up in proportion to the work
+ * that was left.
+ *
+ * @param unfinishedWork[out] bytes of trace target left when the cycle was collected
+ * @return how the last cycle ended relative to free memory
+ */
+ConcurrentPacingOutcome
+MM_ConcurrentGC::updatePacing(MM_EnvironmentBase *env, uintptr_t *unfinishedWork)
+{
+	ConcurrentPacingOutcome outcome = CONCURRENT_PACING_NO_FEEDBACK;
+	*unfinishedWork = 0;
+
+	/* Only an implicit collection ending a cycle that was kicked off by the threshold says anything about where the threshold was */
+	if ((NULL == env->_cycleState) || env->_cycleState->_gcCode.isExplicitGC() || !_stwCollectionInProgress
+		|| _forcedKickoff || (KICKOFF_THRESHOLD_REACHED != _stats.getKickoffReason())) {
+		return outcome;
+	}
+
+	uintptr_t executionModeAtGC = _stats.getExecutionModeAtGC();
+	float kickoffFactor = _pacingKickoffFactor;
+
+	if (CONCURRENT_EXHAUSTED <= executionModeAtGC) {
+		uintptr_t remainingFreeAtKickoff = _stats.getRemainingFree();
+		uintptr_t kickoffThreshold = _stats.getKickoffThreshold();
+		if ((0 != remainingFreeAtKickoff) && (0 != kickoffThreshold)) {
+			/* Tracing should have run out of work with no more than the kickoff buffer left */
+			float unusedRatio = (float)_pacingFreeAtExhausted / (float)remainingFreeAtKickoff;
+			float bufferRatio = (float)_kickoffThresholdBuffer / (float)kickoffThreshold;
+			if (unusedRatio > (2 * bufferRatio)) {
+				kickoffFactor *= (1 - (CONCURRENT_PACING_GAIN * (unusedRatio - bufferRatio)));
+				outcome = CONCURRENT_PACING_COMPLETED_EARLY;
+			} else {
+				outcome = CONCURRENT_PACING_COMPLETED_ON_TIME;
+			}
+		}
+	} else if (CONCURRENT_OFF < executionModeAtGC) {
+		uintptr_t traceTarget = _stats.getTraceSizeTarget();
+		float unfinishedRatio = 1;
+		if (CONCURRENT_TRACE_ONLY <= executionModeAtGC) {
+			*unfinishedWork = MM_Math::saturatingSubtract(traceTarget, _stats.getTotalTraced());
+			unfinishedRatio = (0 == traceTarget) ? 0 : ((float)*unfinishedWork / (float)traceTarget);
+		} else {
+			/* Still initializing or scanning roots; none of the tracing was done concurrently */
+			*unfinishedWork = traceTarget;
+		}
+		kickoffFactor *= (1 + (CONCURRENT_PACING_GAIN * unfinishedRatio));
+		outcome = CONCURRENT_PACING_NOT_COMPLETED;
+	}
+
+	_pacingKickoffFactor = OMR_MIN(OMR_MAX(kickoffFactor, CONCURRENT_PACING_MIN_KICKOFF_FACTOR), CONCURRENT_PACING_MAX_KICKOFF_FACTOR);
+
+	return outcome;
+}
+
+/**
+ * Determine how long marking is expected to take once concurrent helpers are taken into account.
+ * The mutator tax alone finishes the trace in the projected time to exhaustion, and the helpers alone would
+ * finish it in their trace time; working side by side they finish in the parallel combination of the two.
+ * The helpers' share is capped so the combined progress is at most the maximum mutator trace rate, as helper
+ * throughput drops when mutators compete for CPU.
+ *
+ * @param exhaustionTime milliseconds until free memory at kickoff runs out with tracing paid for by the tax alone
+ * @param helperTraceTime milliseconds the concurrent helpers need to trace the target alone, 0 if unknown
+ * @param maxTraceRateFactor ratio of the maximum to the normal mutator trace rate
+ * @return the expected marking time in milliseconds, never more than exhaustionTime
+ */
+float
+MM_ConcurrentGC::getPacedMarkTime(float exhaustionTime, float helperTraceTime, float maxTraceRateFactor)
+{
+	float markTime = exhaustionTime;
+
+	if ((0 < exhaustionTime) && (0 < helperTraceTime)) {
+		markTime = (exhaustionTime * helperTraceTime) / (exhaustionTime + helperTraceTime);
+		markTime = OMR_MAX(markTime, exhaustionTime / OMR_MAX(maxTraceRateFactor, (float)1));
+	}
+
+	return markTime;
+}
+
 /**
  * Update tuning statistics at end of a concurrent cycle.
  *
@@ -1949,6 +2121,7 @@ MM_ConcurrentGC::potentialFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescript
 void
 MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	float newConHelperRate;
 
 	/* Single thread this code; ensure update for earlier interval completes
@@ -1958,6 +2131,7 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 
 	if (_lastFreeSize == LAST_FREE_SIZE_NEEDS_INITIALIZING) {
         _lastFreeSize =  freeSize;
+        _pacingIntervalStartTime = omrtime_hires_clock();
         _tuningUpdateInterval= (uintptr_t)((float)freeSize  * TUNING_HEAP_SIZE_FACTOR);
 
         if (_tuningUpdateInterval > _maxTraceSize) {
@@ -1974,11 +2148,13 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
          */
 		uintptr_t totalTraced = _stats.getTraceSizeCount() + _stats.getCardCleanCount();
 		uintptr_t freeSpaceUsed = _lastFreeSize - freeSize;
+		uintptr_t conTracedInInterval = 0;
 
 		/* Update concurrent helper trace rate if we have any */
 		if (_conHelpersStarted > 0) {
 			uintptr_t conTraced = _stats.getConHelperTraceSizeCount() +  _stats.getConHelperCardCleanCount();
-			newConHelperRate =  (float)(conTraced - _lastConHelperTraceSizeCount) / (float) (freeSpaceUsed);
+			conTracedInInterval = conTraced - _lastConHelperTraceSizeCount;
+			newConHelperRate =  (float)conTracedInInterval / (float) (freeSpaceUsed);
 			_lastConHelperTraceSizeCount = conTraced;
 			_alloc2ConHelperTraceRate = MM_Math::weightedAverage(_alloc2ConHelperTraceRate,
 														newConHelperRate,
@@ -1994,6 +2170,23 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 			_maxAverageAlloc2TraceRate =  _lastAverageAlloc2TraceRate;
 		}
 
+		/* Measure allocation and concurrent helper tracing against time for the pacing controller */
+		uint64_t intervalEndTime = omrtime_hires_clock();
+		uint64_t intervalMicros = omrtime_hires_delta(_pacingIntervalStartTime, intervalEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 != intervalMicros) {
+			float intervalMillis = (float)intervalMicros / 1000;
+			float newAllocationRate = (float)freeSpaceUsed / intervalMillis;
+			float newConHelperTraceRate = (float)conTracedInInterval / intervalMillis;
+			if (0 == _pacingAllocationRate) {
+				_pacingAllocationRate = newAllocationRate;
+				_pacingConHelperTraceRate = newConHelperTraceRate;
+			} else {
+				_pacingAllocationRate = MM_Math::weightedAverage(_pacingAllocationRate, newAllocationRate, CONCURRENT_PACING_HISTORY_WEIGHT);
+				_pacingConHelperTraceRate = MM_Math::weightedAverage(_pacingConHelperTraceRate, newConHelperTraceRate, CONCURRENT_PACING_HISTORY_WEIGHT);
+			}
+		}
+		_pacingIntervalStartTime = intervalEndTime;
+
 		/* Set for next interval */
 		_lastFreeSize = freeSize;
 	}
@@ -2407,6 +2600,92 @@ MM_ConcurrentGC::completeConcurrentSweepForKickoff(MM_EnvironmentBase *env)
 
 	((MM_ConcurrentSweepScheme *)_sweepScheme)->completeSweepingConcurrently(env);
 }
+
+/**
+ * Hand the lazy sweep left behind by a global collection to the concurrent helper threads.
+ * Helpers run at minimum priority, so they sweep on otherwise idle processors and mutators
+ * rarely have to sweep inline to pay their allocation tax.
+ * Called after a collection and whenever exclusive access is released, as an exclusive access
+ * request parks helpers that were sweeping.
+ */
+void
+MM_ConcurrentGC::resumeConHelperThreadsForSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = (MM_ConcurrentSweepScheme *)_sweepScheme;
+
+	if ((_conHelpersStarted > 0) && _extensions->concurrentSweep && _extensions->concurrentSweepBackground
+		&& (CONCURRENT_OFF == _stats.getExecutionMode()) && concurrentSweep->canCompleteSweepConcurrently()) {
+		omrthread_monitor_enter(_conHelpersActivationMonitor);
+		if (CONCURRENT_HELPER_WAIT == _conHelpersRequest) {
+			_conHelpersRequest = CONCURRENT_HELPER_SWEEP;
+			concurrentSweep->setBackgroundSweepRequested(true);
+			omrthread_monitor_notify_all(_conHelpersActivationMonitor);
+		}
+		omrthread_monitor_exit(_conHelpersActivationMonitor);
+	}
+}
+
+/**
+ * Background sweep loop for a concurrent helper thread.
+ * Sweeps a budgeted slice of chunks at a time, yielding the processor between slices and
+ * stopping as soon as the request changes (kickoff or shutdown). An exclusive access request
+ * parks the helpers, and hookExclusiveAccessRelease() hands the sweep back once it is released.
+ * @note Expects the helper to hold VM access.
+ */
+void
+MM_ConcurrentGC::conHelperSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = (MM_ConcurrentSweepScheme *)_sweepScheme;
+	uintptr_t chunkBudget = OMR_MAX(_extensions->concurrentSweepBackgroundChunkBudget, 1);
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	ConHelperRequest request = CONCURRENT_HELPER_SWEEP;
+	bool moreWork = true;
+
+	/* Helpers attach before the memory pools size the free entry profile, so this thread's sweep stats are sized on first use */
+	if (0 == env->_freeEntrySizeClassStats.getMaxSizeClasses()) {
+		uintptr_t veryLargeObjectThreshold = (_extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold <= _extensions->memoryMax) ? 0 : _extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold;
+		if (!env->_freeEntrySizeClassStats.initialize(env, _extensions->largeObjectAllocationProfilingTopK, _extensions->freeMemoryProfileMaxSizeClasses, veryLargeObjectThreshold)) {
+			/* Drop back to the unsized stats and leave the sweep to the mutators' allocation tax */
+			env->_freeEntrySizeClassStats.tearDown(env);
+			env->_freeEntrySizeClassStats.initialize(env, 0, 0, 0);
+			moreWork = false;
+		}
+	}
+
+	while ((CONCURRENT_HELPER_SWEEP == request) && moreWork) {
+		moreWork = concurrentSweep->sweepInBackground(env, chunkBudget);
+		if (moreWork) {
+			if (env->isExclusiveAccessRequestWaiting()) {
+				/* Exclusive access cannot be granted before this helper releases VM access, so the release hook is still to come */
+				request = switchConHelperRequest(CONCURRENT_HELPER_SWEEP, CONCURRENT_HELPER_WAIT);
+			} else {
+				omrthread_yield();
+				request = getConHelperRequest(env);
+			}
+		}
+	}
+
+	if (!moreWork) {
+		/* Nothing left to sweep - mutators pay their own tax again and the helpers park unless the request has already moved on */
+		concurrentSweep->setBackgroundSweepRequested(false);
+		switchConHelperRequest(CONCURRENT_HELPER_SWEEP, CONCURRENT_HELPER_WAIT);
+	}
+
+	env->popVMstate(oldVMstate);
+}
+
+/**
+ * Resume background sweeping once exclusive access is released.
+ * This is a wrapper into the non-static MM_ConcurrentGC::resumeConHelperThreadsForSweep
+ */
+void
+MM_ConcurrentGC::hookExclusiveAccessRelease(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ExclusiveAccessReleaseEvent *event = (MM_ExclusiveAccessReleaseEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	((MM_ConcurrentGC *)userData)->resumeConHelperThreadsForSweep(env);
+}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 /**
@@ -2743,6 +3022,7 @@ MM_ConcurrentGC::doConcurrentTrace(MM_EnvironmentBase *env,
 			_concurrentDelegate.isConcurrentScanningComplete(env)) {
 
 			if(_stats.switchExecutionMode(CONCURRENT_CLEAN_TRACE, CONCURRENT_EXHAUSTED)) {
+				_pacingFreeAtExhausted = remainingFree;
 				/* Tell all MSS to use slow path allocate and so get to a safe
 				* point before paying allocation tax.
 				*/
@@ -2937,8 +3217,11 @@ MM_ConcurrentGC::clearConcurrentWorkStackOverflow()
 	_stats.setConcurrentWorkStackOverflowOcurred(false);
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
-	MM_WorkPacketsConcurrent *packets = (MM_WorkPacketsConcurrent *)_markingScheme->getWorkPackets();
-	packets->resetWorkPacketsOverflow();
+	/* Only the incremental update barrier uses concurrent work packets with a card dirtying overflow handler */
+	if (_extensions->configuration->isIncrementalUpdateBarrierEnabled()) {
+		MM_WorkPacketsConcurrent *packets = (MM_WorkPacketsConcurrent *)_markingScheme->getWorkPackets();
+		packets->resetWorkPacketsOverflow();
+	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 }
 
@@ -3037,8 +3320,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		if (_stats.switchExecutionMode(executionModeAtGC, CONCURRENT_OFF)) {
 #if defined(OMR_GC_REALTIME)
 			if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-				if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
-					((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
+				MM_WorkPacketsSATB *workPacketsSATB = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+				_stats.setSATBBarrierStats(workPacketsSATB->getBarrierOverflowCount(), workPacketsSATB->getPublishedBarrierPacketCount(), workPacketsSATB->getBarrierPublishCount());
+				workPacketsSATB->resetBarrierStats();
+				if (workPacketsSATB->inUsePacketsAvailable(env)) {
+					workPacketsSATB->moveInUseToNonEmpty(env);
 					_extensions->sATBBarrierRememberedSet->flushFragments(env);
 				}
 			}
@@ -3223,6 +3509,11 @@ MM_ConcurrentGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	/* Call the super class to do any required work */
 	MM_ParallelGlobalGC::internalPostCollect(env, subSpace);
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/* Let the helpers sweep in the background until the next kickoff */
+	resumeConHelperThreadsForSweep(env);
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
 	Trc_MM_ConcurrentGC_internalPostCollect_Exit(env->getLanguageVMThread(), subSpace);
 }
 
@@ -3351,8 +3642,8 @@ MM_ConcurrentGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 	/* Contract any superclass structures */
 	bool result = MM_ParallelGlobalGC::heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
-	/* ...and then contract the card table */
-	result = result && ((MM_ConcurrentCardTable *)_cardTable)->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	/* ...and then contract the card table, if the barrier has one */
+	result = result && ((NULL == _cardTable) || ((MM_ConcurrentCardTable *)_cardTable)->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress));
 	_heapAlloc = (void *)_extensions->heap->getHeapTop();
 
 	Trc_MM_ConcurrentGC_heapRemoveRange_Exit(env->getLanguageVMThread());
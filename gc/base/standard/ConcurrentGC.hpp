@@ -122,6 +122,11 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define LAST_FREE_SIZE_NEEDS_INITIALIZING ((uintptr_t)-1)
 #define ALL_BYTES_TRACED_IN_PASS_1 ((float)1.0)
 
+#define CONCURRENT_PACING_HISTORY_WEIGHT ((float)0.5)
+#define CONCURRENT_PACING_GAIN ((float)0.5)
+#define CONCURRENT_PACING_MIN_KICKOFF_FACTOR ((float)0.5)
+#define CONCURRENT_PACING_MAX_KICKOFF_FACTOR ((float)2.0)
+
 /**
  * @}
  */
@@ -238,6 +243,13 @@ private:
 	float _maxAverageAlloc2TraceRate;
 	uintptr_t _lastTotalTraced;
 
+	/* Pacing controller statistics */
+	float _pacingKickoffFactor; /**< feedback scaling applied to the computed kickoff threshold */
+	float _pacingAllocationRate; /**< average taxable bytes allocated per millisecond over recent tuning intervals */
+	float _pacingConHelperTraceRate; /**< average bytes traced by concurrent helpers per millisecond over recent tuning intervals */
+	uint64_t _pacingIntervalStartTime; /**< hires time at which the current tuning interval started */
+	uintptr_t _pacingFreeAtExhausted; /**< taxable free bytes left when tracing ran out of work this cycle */
+
 	/* Background helper thread statistics */
 	uintptr_t _lastConHelperTraceSizeCount;
 	float _alloc2ConHelperTraceRate;
@@ -258,6 +270,7 @@ protected:
 	typedef enum {
 		CONCURRENT_HELPER_WAIT = 1,
 		CONCURRENT_HELPER_MARK,
+		CONCURRENT_HELPER_SWEEP,
 		CONCURRENT_HELPER_SHUTDOWN
 	} ConHelperRequest;
 
@@ -304,6 +317,7 @@ private:
 	void kickoffCardCleaning(MM_EnvironmentBase *env, ConcurrentCardCleaningReason reason);
 	
 	void adjustTraceTarget();
+	ConcurrentPacingOutcome updatePacing(MM_EnvironmentBase *env, uintptr_t *unfinishedWork);
 	void updateTuningStatistics(MM_EnvironmentBase *env);
 	void tuneToHeap(MM_EnvironmentBase *env);
 
@@ -323,6 +337,7 @@ private:
 
 	void reportConcurrentKickoff(MM_EnvironmentBase *env);
 	void reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason);
+	void reportConcurrentPacing(MM_EnvironmentBase *env, ConcurrentPacingOutcome outcome, uintptr_t unfinishedWork, float exhaustionTime, float helperTraceTime);
 	virtual void reportConcurrentHalted(MM_EnvironmentBase *env);
 	void reportConcurrentFinalCardCleaningStart(MM_EnvironmentBase *env);
 	void reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, uint64_t duration);
@@ -349,6 +364,9 @@ private:
 	void concurrentSweep(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_AllocateDescription *allocDescription);
 	void completeConcurrentSweep(MM_EnvironmentBase *env);
 	void completeConcurrentSweepForKickoff(MM_EnvironmentBase *env);
+	void resumeConHelperThreadsForSweep(MM_EnvironmentBase *env);
+	void conHelperSweep(MM_EnvironmentBase *env);
+	static void hookExclusiveAccessRelease(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)		
@@ -399,6 +417,7 @@ public:
 	virtual void abortCollection(MM_EnvironmentBase *env, CollectionAbortReason reason);
 	
 	static void signalThreadsToActivateWriteBarrierAsyncEventHandler(OMR_VMThread *omrVMThread, void *userData);
+	static float getPacedMarkTime(float exhaustionTime, float helperTraceTime, float maxTraceRateFactor);
 	
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
@@ -512,6 +531,11 @@ public:
 		,_lastAverageAlloc2TraceRate(0)
 		,_maxAverageAlloc2TraceRate(0)
 		,_lastTotalTraced(0)
+		,_pacingKickoffFactor(1.0)
+		,_pacingAllocationRate(0)
+		,_pacingConHelperTraceRate(0)
+		,_pacingIntervalStartTime(0)
+		,_pacingFreeAtExhausted(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
 		,_forcedKickoff(false)
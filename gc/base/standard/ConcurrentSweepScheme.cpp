@@ -1104,6 +1104,11 @@ MM_ConcurrentSweepScheme::calculateTax(MM_EnvironmentBase *envModron, UDATA allo
 
 	chunkTax = (UDATA)(((double)(_stats._totalChunkCount - _stats._totalChunkSweptCount)) * allocatePercentage);
 
+	/* Background sweepers own the sweep between their slices too, so a mutator only pays its share of the outstanding chunks */
+	if ((0 == chunkTax) && isBackgroundSweepRequested()) {
+		return 0;
+	}
+
 	/* Make sure we get at least 1 chunk */
 	return (0 == chunkTax) ? 1 : chunkTax;
 }
@@ -1566,6 +1571,47 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep a budgeted number of chunks on behalf of a background helper thread.
+ * Chunks are claimed through the same per pool iterator as allocation tax and replenishPoolForAllocate(),
+ * so the helper only ever sweeps chunks nobody else owns, and connection remains the job of the allocating
+ * thread under the pool allocation lock.  Returning after the budget lets the caller yield the processor
+ * and give way to a pending exclusive access request.
+ * @note The caller is expected to hold VM access, which keeps the sweep from being completed underneath it.
+ * @param chunkBudget Maximum number of chunks to sweep before returning
+ * @return true if the budget was used up and more work may remain, false if there was nothing left to sweep.
+ */
+bool
+MM_ConcurrentSweepScheme::sweepInBackground(MM_EnvironmentBase *envModron, UDATA chunkBudget)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+	UDATA chunksSwept = 0;
+
+	if(!_stats.canCompleteSweepConcurrently()) {
+		return false;
+	}
+
+	increaseActiveSweepingThreadCount(env, false);
+
+	MM_HeapMemoryPoolIterator poolIterator(envModron, _extensions->heap);
+	MM_MemoryPool *memoryPool;
+	while((chunksSwept < chunkBudget) && (NULL != (memoryPool = poolIterator.nextPool()))) {
+		MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+
+		if(!sweepState->_finalFlushed) {
+			while((chunksSwept < chunkBudget) && sweepNextAvailableChunk(env, sweepState)) {
+				chunksSwept += 1;
+			}
+		}
+	}
+
+	decreaseActiveSweepingThreadCount(env, false);
+
+	MM_AtomicOperations::add((UDATA *)&_stats._backgroundChunkSweptCount, chunksSwept);
+
+	return (chunksSwept == chunkBudget);
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
@@ -74,6 +74,7 @@ class MM_ConcurrentSweepScheme : public MM_ParallelSweepScheme
 	 */
 private:
 	volatile UDATA _concurrentSweepingThreadCount;  /**< Number of threads currently sweeping concurrently */
+	volatile bool _backgroundSweepRequested;  /**< Set while the lazy sweep of this cycle is handed to the background helper threads */
 	omrthread_monitor_t _completeSweepingConcurrentlyLock;  /**< Lock to gain access to number of threads completing sweep concurrently */
 protected:
 	MM_GlobalCollector *_collector;  /**< Global collector to which the receiver is associated */
@@ -156,11 +157,23 @@ public:
 	virtual void *createSweepPoolState(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
 
 	bool isConcurrentSweepActive() { return _stats.isConcurrentSweepActive(); }
+	bool canCompleteSweepConcurrently() { return _stats.canCompleteSweepConcurrently(); }
+
+	/**
+	 * Record whether the lazy sweep has been handed to the background helper threads.
+	 */
+	void setBackgroundSweepRequested(bool requested) { _backgroundSweepRequested = requested; }
+
+	/**
+	 * @return true if the lazy sweep is handed to the background helper threads and is still being completed concurrently.
+	 */
+	bool isBackgroundSweepRequested() { return _backgroundSweepRequested && _stats.canCompleteSweepConcurrently(); }
 
 	virtual void sweep(MM_EnvironmentBase *env);
 	virtual void completeSweep(MM_EnvironmentBase* env, SweepCompletionReason reason);
 	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
 	bool completeSweepingConcurrently(MM_EnvironmentBase *envModron);
+	bool sweepInBackground(MM_EnvironmentBase *envModron, UDATA chunkBudget);
 
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size);
 	void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescriptionn);
@@ -173,6 +186,7 @@ public:
 	MM_ConcurrentSweepScheme(MM_EnvironmentBase *env, MM_GlobalCollector *collector)
 		: MM_ParallelSweepScheme(env)
 		, _concurrentSweepingThreadCount(0)
+		, _backgroundSweepRequested(false)
 		, _completeSweepingConcurrentlyLock(NULL)
 		, _collector(collector)
 		, _stats()
@@ -33,9 +33,6 @@
 #include "ConcurrentGCIncrementalUpdate.hpp"
 #include "ConcurrentGCSATB.hpp"
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-#include "ConcurrentSweepGC.hpp"
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 #include "EnvironmentStandard.hpp"
 #include "GlobalCollector.hpp"
 #include "GCExtensionsBase.hpp"
@@ -81,6 +78,13 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (extensions->concurrentSweep && !extensions->isConcurrentMarkEnabled()) {
+			/* Only the concurrent mark collector drives a concurrent sweep, so fall back to sweeping inside the collection */
+			extensions->concurrentSweep = false;
+			extensions->concurrentSweepBackground = false;
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
 	}
@@ -114,9 +118,9 @@ MM_ConfigurationStandard::initializeGCThreadCount(MM_EnvironmentBase* env)
 MM_GlobalCollector*
 MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 {
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_MODRON_CONCCURENT_SWEEP)
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK || OMR_GC_CONCURRENT_SWEEP */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	if (extensions->concurrentMark) {
@@ -127,11 +131,6 @@ MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 		}
 	}
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-	if (extensions->concurrentSweep) {
-		return MM_ConcurrentSweepGC::newInstance(env);
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 	return MM_ParallelGlobalGC::newInstance(env);
 }
 
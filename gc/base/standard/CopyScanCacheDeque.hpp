@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+class MM_CopyScanCacheStandard;
+
+/**
+ * Fixed capacity, single owner work-stealing deque of scan caches (Chase-Lev).
+ * The owning GC thread pushes and pops at the bottom without any atomic operation (except when
+ * racing for the last entry), while other GC threads steal from the top with a single compare-and-swap.
+ * A push that finds the deque full fails, and the caller falls back to the shared scan list.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		CAPACITY = 256 /**< number of entries in the deque, must be a power of 2 */
+	};
+
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves (and the owner taking the last entry) */
+	uint8_t _topPadding[CACHE_LINE_SIZE - sizeof(uintptr_t)]; /**< keep thieves and the owner on separate cache lines */
+	volatile uintptr_t _bottom; /**< index one past the newest entry, written only by the owner */
+	uint32_t _stealSeed; /**< owner's pseudo random state used to pick the first steal victim */
+	volatile uintptr_t _advertised; /**< 1 while this deque is counted in *_nonEmptyCount, changed with compare-and-swap by the owner and by thieves */
+	volatile uintptr_t *_nonEmptyCount; /**< count of possibly non-empty deques shared by all deques of the scavenge (may be NULL) */
+	MM_CopyScanCacheStandard * volatile _entries[CAPACITY];
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Push a cache to the bottom of the deque. May only be called by the owning thread.
+	 * @param cache[in] the cache to push
+	 * @return true if the cache was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= CAPACITY) {
+			return false;
+		}
+		_entries[bottom & (CAPACITY - 1)] = cache;
+		/* entry must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		/* count the deque after the entry is published, so that a thief dropping it from the count after taking
+		 * the previous last entry either sees the new bottom on its re-check or loses the flag to this push
+		 */
+		advertise();
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed cache. May only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty (or the last entry was stolen)
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			/* thieves can not move top past bottom, so we are empty */
+			unadvertise();
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation before looking at top (pairs with the barrier in steal()) */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		MM_CopyScanCacheStandard *cache = NULL;
+		if (top < bottom) {
+			/* more than one entry, no race with thieves */
+			cache = _entries[bottom & (CAPACITY - 1)];
+		} else {
+			if (top == bottom) {
+				/* last entry, race with thieves for it */
+				cache = _entries[bottom & (CAPACITY - 1)];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					cache = NULL;
+				}
+			}
+			/* deque is now empty, top == bottom + 1 */
+			_bottom = bottom + 1;
+			unadvertise();
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the oldest cache. May be called by any thread.
+	 * A thief taking the last entry drops the deque from the shared count, so idle threads stop polling a deque
+	 * that its owner will not look at again until it finishes its current scan cache.
+	 * @return the cache, or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+
+		MM_CopyScanCacheStandard *cache = NULL;
+		if (top < bottom) {
+			cache = _entries[top & (CAPACITY - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			} else if ((top + 1) == bottom) {
+				unadvertise();
+				/* the owner may have pushed after we read bottom and found the flag still set, count it again if so */
+				if (!isEmpty()) {
+					advertise();
+				}
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Approximate number of entries, not synchronized with concurrent push/pop/steal.
+	 */
+	MMINLINE uintptr_t
+	getApproximateEntryCount()
+	{
+		uintptr_t top = _top;
+		uintptr_t bottom = _bottom;
+		return (bottom > top) ? (bottom - top) : 0;
+	}
+
+	MMINLINE bool isEmpty() { return _bottom <= _top; }
+
+	/**
+	 * Share a count of possibly non-empty deques with the other deques of the scavenge.
+	 * A deque is counted from a push until its owner finds it empty or a thief takes its last entry. Only while its owner
+	 * is inside push() can a non-empty deque be uncounted, so a zero count seen by a waiting thread means that every deque is empty.
+	 * @param nonEmptyCount[in] the shared count
+	 */
+	MMINLINE void setNonEmptyCount(volatile uintptr_t *nonEmptyCount) { _nonEmptyCount = nonEmptyCount; }
+
+	/**
+	 * Generate the next pseudo random number used for steal victim selection. May only be called by the owning thread.
+	 * @param bound[in] exclusive upper bound of the returned value
+	 */
+	MMINLINE uintptr_t
+	nextRandom(uintptr_t bound)
+	{
+		/* xorshift32 - cheap and good enough to spread thieves over victims */
+		uint32_t seed = _stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		_stealSeed = seed;
+		return (uintptr_t)seed % bound;
+	}
+
+	/**
+	 * Reset an empty deque before a new scavenge.
+	 * @param seed[in] non-zero initial value for victim selection
+	 */
+	void
+	reset(uint32_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_stealSeed = (0 == seed) ? 1 : seed;
+		_advertised = 0;
+	}
+
+	MM_CopyScanCacheDeque()
+		: _top(0)
+		, _bottom(0)
+		, _stealSeed(1)
+		, _advertised(0)
+		, _nonEmptyCount(NULL)
+	{
+	}
+
+private:
+	/**
+	 * Count the deque in the shared non-empty count unless it already is.
+	 */
+	MMINLINE void
+	advertise()
+	{
+		if ((0 == _advertised) && (0 == MM_AtomicOperations::lockCompareExchange(&_advertised, 0, 1))) {
+			if (NULL != _nonEmptyCount) {
+				MM_AtomicOperations::add(_nonEmptyCount, 1);
+			}
+		}
+	}
+
+	/**
+	 * Drop the deque from the shared non-empty count once it has been found empty.
+	 */
+	MMINLINE void
+	unadvertise()
+	{
+		if ((1 == _advertised) && (1 == MM_AtomicOperations::lockCompareExchange(&_advertised, 1, 0))) {
+			if (NULL != _nonEmptyCount) {
+				MM_AtomicOperations::subtract(_nonEmptyCount, 1);
+			}
+		}
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "IdleHeapReleaser.hpp"
+
+#include "mmprivatehook.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+
+MM_IdleHeapReleaser *
+MM_IdleHeapReleaser::newInstance(MM_GCExtensionsBase *extensions)
+{
+	MM_IdleHeapReleaser *releaser = (MM_IdleHeapReleaser *)extensions->getForge()->allocate(sizeof(MM_IdleHeapReleaser), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_IdleHeapReleaser(extensions);
+		if (!releaser->initialize(extensions)) {
+			releaser->kill(extensions);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_IdleHeapReleaser::kill(MM_GCExtensionsBase *extensions)
+{
+	tearDown(extensions);
+	extensions->getForge()->free(this);
+}
+
+bool
+MM_IdleHeapReleaser::initialize(MM_GCExtensionsBase *extensions)
+{
+	return 0 == omrthread_monitor_init_with_name(&_releaserMonitor, 0, "MM_IdleHeapReleaser::_releaserMonitor");
+}
+
+void
+MM_IdleHeapReleaser::tearDown(MM_GCExtensionsBase *extensions)
+{
+	stopReleaser();
+
+	if (NULL != _releaserMonitor) {
+		omrthread_monitor_destroy(_releaserMonitor);
+		_releaserMonitor = NULL;
+	}
+}
+
+bool
+MM_IdleHeapReleaser::startReleaser()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not report its state before we wait */
+	omrthread_monitor_enter(_releaserMonitor);
+	_releaserState = RELEASER_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		releaser_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (RELEASER_STARTING == _releaserState) {
+			omrthread_monitor_wait(_releaserMonitor);
+		}
+		success = (RELEASER_RUNNING == _releaserState);
+	}
+	if (!success) {
+		_releaserState = RELEASER_NONE;
+	}
+	omrthread_monitor_exit(_releaserMonitor);
+
+	return success;
+}
+
+void
+MM_IdleHeapReleaser::stopReleaser()
+{
+	omrthread_monitor_enter(_releaserMonitor);
+	if (RELEASER_NONE != _releaserState) {
+		while (RELEASER_TERMINATED != _releaserState) {
+			_releaserState = RELEASER_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_releaserMonitor);
+			omrthread_monitor_wait(_releaserMonitor);
+		}
+		_releaserState = RELEASER_NONE;
+	}
+	omrthread_monitor_exit(_releaserMonitor);
+}
+
+void
+MM_IdleHeapReleaser::sampleHeapActivity(HeapActivity *activity)
+{
+	activity->gcCount = _extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	activity->gcCount += _extensions->scavengerStats._gcCount;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	activity->freeBytes = _extensions->heap->getActualFreeMemorySize();
+}
+
+void
+MM_IdleHeapReleaser::releaseFreeMemory(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MemorySpace *memorySpace = _extensions->heap->getDefaultMemorySpace();
+	MM_MemorySubSpace *memorySubSpace = memorySpace->getTenureMemorySubSpace();
+
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t releasedBytes = memorySpace->releaseFreeMemoryPages(env);
+	uint64_t endTime = omrtime_hires_clock();
+
+	_releaseCount += 1;
+	_releasedBytes += releasedBytes;
+
+	TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		endTime,
+		J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+		HEAP_RELEASE_FREE_PAGES,
+		memorySubSpace->getTypeFlags(),
+		/* GC Time Ratio not applicable for "release free heap pages" */
+		0,
+		releasedBytes,
+		memorySubSpace->getActiveMemorySize(),
+		omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
+		1
+		);
+}
+
+int J9THREAD_PROC
+MM_IdleHeapReleaser::releaser_thread_proc(void *info)
+{
+	MM_IdleHeapReleaser *releaser = (MM_IdleHeapReleaser *)info;
+	releaser->releaserEntryPoint();
+	return 0;
+}
+
+void
+MM_IdleHeapReleaser::releaserEntryPoint()
+{
+	OMR_VM *omrVM = _extensions->getOmrVM();
+
+	/* The releaser takes VM access to keep collections out, so it needs a VM thread */
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(omrVM, "GC Idle Heap Releaser", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	if (NULL != omrVMThread) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		HeapActivity previousActivity;
+		HeapActivity currentActivity;
+
+		omrthread_monitor_enter(_releaserMonitor);
+		_releaserState = RELEASER_RUNNING;
+		omrthread_monitor_notify_all(_releaserMonitor);
+		omrthread_monitor_exit(_releaserMonitor);
+
+		env->acquireVMAccess();
+		sampleHeapActivity(&previousActivity);
+		env->releaseVMAccess();
+
+		omrthread_monitor_enter(_releaserMonitor);
+		while (RELEASER_TERMINATION_REQUESTED != _releaserState) {
+			omrthread_monitor_wait_timed(_releaserMonitor, _extensions->idleHeapReleaseIntervalMillis, 0);
+			if (RELEASER_TERMINATION_REQUESTED == _releaserState) {
+				break;
+			}
+			omrthread_monitor_exit(_releaserMonitor);
+
+			env->acquireVMAccess();
+			sampleHeapActivity(&currentActivity);
+			/* Idle for a whole interval, and something was allocated or collected since the last release */
+			if (isSameActivity(&previousActivity, &currentActivity)
+				&& !(_hasReleased && isSameActivity(&_releasedActivity, &currentActivity))
+				&& !env->isExclusiveAccessRequestWaiting()
+			) {
+				releaseFreeMemory(env);
+				_releasedActivity = currentActivity;
+				_hasReleased = true;
+			}
+			env->releaseVMAccess();
+			previousActivity = currentActivity;
+
+			omrthread_monitor_enter(_releaserMonitor);
+		}
+
+		omrthread_monitor_exit(_releaserMonitor);
+
+		MM_EnvironmentBase::detachVMThread(omrVM, omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	}
+
+	omrthread_monitor_enter(_releaserMonitor);
+	_releaserState = RELEASER_TERMINATED;
+	omrthread_monitor_notify_all(_releaserMonitor);
+	omrthread_exit(_releaserMonitor);
+}
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(IDLEHEAPRELEASER_HPP_)
+#define IDLEHEAPRELEASER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Releases the free memory of an idle heap from a background thread.
+ *
+ * The releaser thread samples the heap every idleHeapReleaseIntervalMillis. When a whole interval
+ * passes without a collection or an allocation from the memory pools, the application is taken to
+ * be idle and the page aligned interiors of the free entries are decommitted, as an idle GC does
+ * with gcOnIdle but without stopping the world. Decommitted pages are committed again lazily,
+ * by the operating system, when allocation next touches them.
+ */
+class MM_IdleHeapReleaser : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Heap activity at a point in time. Two equal samples mean nothing was allocated or
+	 * collected in between.
+	 */
+	struct HeapActivity {
+		uintptr_t gcCount; /**< collections of any kind completed */
+		uintptr_t freeBytes; /**< memory free for allocation in the memory pools */
+	};
+
+	enum ReleaserState {
+		RELEASER_NONE = 0, /**< no releaser thread */
+		RELEASER_STARTING,
+		RELEASER_RUNNING,
+		RELEASER_TERMINATION_REQUESTED,
+		RELEASER_TERMINATED
+	};
+
+	MM_GCExtensionsBase *_extensions;
+
+	omrthread_monitor_t _releaserMonitor; /**< protects _releaserState and wakes the releaser */
+	volatile ReleaserState _releaserState; /**< lifecycle of the releaser thread */
+
+	HeapActivity _releasedActivity; /**< heap activity when free memory was last released; nothing new is releasable until it changes */
+	bool _hasReleased; /**< true once _releasedActivity has been recorded */
+
+	uintptr_t _releaseCount; /**< number of times free memory was released */
+	uintptr_t _releasedBytes; /**< total bytes decommitted */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_IdleHeapReleaser *newInstance(MM_GCExtensionsBase *extensions);
+	virtual void kill(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Start the releaser thread.
+	 * @return true if the thread is running, false otherwise
+	 */
+	bool startReleaser();
+
+	/**
+	 * Stop the releaser thread and wait for it to exit. Safe to call if it was never started.
+	 */
+	void stopReleaser();
+
+	MMINLINE uintptr_t getReleaseCount() { return _releaseCount; }
+	MMINLINE uintptr_t getReleasedBytes() { return _releasedBytes; }
+
+	MM_IdleHeapReleaser(MM_GCExtensionsBase *extensions)
+		: MM_BaseVirtual()
+		, _extensions(extensions)
+		, _releaserMonitor(NULL)
+		, _releaserState(RELEASER_NONE)
+		, _hasReleased(false)
+		, _releaseCount(0)
+		, _releasedBytes(0)
+	{
+		_typeId = __FUNCTION__;
+		_releasedActivity.gcCount = 0;
+		_releasedActivity.freeBytes = 0;
+	}
+
+protected:
+	bool initialize(MM_GCExtensionsBase *extensions);
+	void tearDown(MM_GCExtensionsBase *extensions);
+
+private:
+	/**
+	 * Sample the heap activity.
+	 * @note The caller is expected to hold VM access, so that no collection is in progress.
+	 */
+	void sampleHeapActivity(HeapActivity *activity);
+
+	MMINLINE bool
+	isSameActivity(HeapActivity *activity1, HeapActivity *activity2)
+	{
+		return (activity1->gcCount == activity2->gcCount) && (activity1->freeBytes == activity2->freeBytes);
+	}
+
+	/**
+	 * Decommit the free memory of every memory pool and report it as a release of free pages.
+	 * @note The caller is expected to hold VM access; the pools lock their free lists against allocation.
+	 */
+	void releaseFreeMemory(MM_EnvironmentBase *env);
+
+	void releaserEntryPoint();
+	static int J9THREAD_PROC releaser_thread_proc(void *info);
+};
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+#endif /* IDLEHEAPRELEASER_HPP_ */
@@ -43,6 +43,9 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#include "IdleHeapReleaser.hpp"
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -596,11 +599,13 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		goto compactionReqd;
 	}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* Aborted CS needs global GC with Nursery compaction */
 	if (_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised()) {
 		compactReason = COMPACT_ABORTED_SCAVENGE;
 		goto compactionReqd;
 	}	
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 	/* Is this a system GC ? */ 
 	if(gcCode.isExplicitGC()) { 
@@ -722,7 +727,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -1362,12 +1367,32 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (extensions->idleHeapRelease) {
+		_idleHeapReleaser = MM_IdleHeapReleaser::newInstance(extensions);
+		if (NULL == _idleHeapReleaser) {
+			return false;
+		}
+		if (!_idleHeapReleaser->startReleaser()) {
+			_idleHeapReleaser->kill(extensions);
+			_idleHeapReleaser = NULL;
+			return false;
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _idleHeapReleaser) {
+		_idleHeapReleaser->kill(extensions);
+		_idleHeapReleaser = NULL;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -49,6 +49,7 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
+class MM_IdleHeapReleaser;
 class MM_ParallelDispatcher;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
@@ -80,6 +81,9 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_IdleHeapReleaser *_idleHeapReleaser; /**< releases free memory from a background thread while the heap is idle (NULL if not enabled) */
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 public:
 	
 /*
@@ -345,6 +349,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		, _idleHeapReleaser(NULL)
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	{
 		_typeId = __FUNCTION__;
 	}
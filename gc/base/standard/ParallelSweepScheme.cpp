@@ -191,6 +191,8 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	}
 	_sweepHeapSectioning = extensions->sweepHeapSectioning;
 
+	_sweepKernel.initialize(env, extensions->parSweepVectorKernel);
+
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
@@ -341,14 +343,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = _sweepKernel._findMarkedWord(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -398,6 +393,41 @@ MM_ParallelSweepScheme::sweepMarkMapTail(
 	}
 }
 
+/**
+ * Skip the run of mark map words with live objects starting at markMapCurrent. Every word in the run is a dark matter
+ * candidate, and every darkMatterSampleRate'th candidate is sampled.
+ * @return the dark matter (in bytes) measured by the samples taken in the run
+ */
+MMINLINE uintptr_t
+MM_ParallelSweepScheme::sweepMarkedWords(
+	MM_ParallelSweepChunk *sweepChunk,
+	uintptr_t * &markMapCurrent,
+	uintptr_t *markMapChunkTop,
+	uintptr_t * &heapSlotFreeCurrent,
+	uintptr_t &darkMatterCandidates,
+	uintptr_t &darkMatterSamples,
+	uintptr_t darkMatterSampleRate)
+{
+	uintptr_t darkMatterBytes = 0;
+	uintptr_t runLength = _sweepKernel._findEmptyWord(markMapCurrent, markMapChunkTop) - markMapCurrent;
+
+	/* position in the run of the first candidate whose count is a multiple of the sample rate */
+	uintptr_t sampleOffset = darkMatterSampleRate - 1 - (darkMatterCandidates % darkMatterSampleRate);
+	while (sampleOffset < runLength) {
+		darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleOffset, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleOffset));
+		darkMatterSamples += 1;
+		if ((runLength - sampleOffset) <= darkMatterSampleRate) {
+			break;
+		}
+		sampleOffset += darkMatterSampleRate;
+	}
+
+	darkMatterCandidates += runLength;
+	markMapCurrent += runLength;
+	heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * runLength;
+	return darkMatterBytes;
+}
+
 uintptr_t
 MM_ParallelSweepScheme::performSamplingCalculations(MM_ParallelSweepChunk *sweepChunk, uintptr_t* markMapCurrent, uintptr_t* heapSlotFreeCurrent)
 {
@@ -515,29 +545,26 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 	heapSlotFreeHead = NULL;
 	heapSlotFreeCount = 0;
 	while(markMapCurrent < markMapChunkTop) {
-		/* Check if the map slot is part of a candidate free list entry */
-		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
-		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
-				darkMatterSamples += 1;
-			}
-		} else {
-			/* There is at least a single free slot in the mark map - check the head and tail */
-			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
-			sweepMarkMapTail(markMapCurrent, markMapChunkTop, heapSlotFreeCount);
+		if (J9MODRON_OBM_SLOT_EMPTY != *markMapCurrent) {
+			/* Skip the whole run of map slots with live objects, sampling it for dark matter */
+			darkMatterBytes += sweepMarkedWords(sweepChunk, markMapCurrent, markMapChunkTop, heapSlotFreeCurrent, darkMatterCandidates, darkMatterSamples, darkMatterSampleRate);
+			continue;
+		}
 
-			if (!sweepPoolManager->addFreeMemory(env, sweepChunk, heapSlotFreeHead, heapSlotFreeCount)) {
-				break;
-			}
+		/* The map slot starts a candidate free list entry - check the head and tail */
+		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
+		sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
+		sweepMarkMapTail(markMapCurrent, markMapChunkTop, heapSlotFreeCount);
 
-			/* Reset the free entries for the next body */
-			heapSlotFreeHead = NULL;
-			heapSlotFreeCount = 0;
+		if (!sweepPoolManager->addFreeMemory(env, sweepChunk, heapSlotFreeHead, heapSlotFreeCount)) {
+			break;
 		}
 
-		/* Proceed to the next map slot */
+		/* Reset the free entries for the next body */
+		heapSlotFreeHead = NULL;
+		heapSlotFreeCount = 0;
+
+		/* Proceed past the map slot ending the entry, it is covered by the tail of the entry */
 		heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT;
 		markMapCurrent += 1;
 	}
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
+#include "SweepMarkMapKernel.hpp"
 
 class MM_AllocateDescription;
 class MM_MemoryPool;
@@ -106,6 +107,7 @@ protected:
 	void *_heapBase;
 
 	MM_SweepHeapSectioning *_sweepHeapSectioning;	/**< pointer to Sweep Heap Sectioning */
+	MM_SweepMarkMapKernel _sweepKernel;	/**< mark map scanning primitives selected for this processor */
 
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
 	omrthread_monitor_t _mutexSweepPoolState;	/**< Monitor to protect memory pool operations for sweepPoolState*/
@@ -125,6 +127,7 @@ protected:
 	void sweepMarkMapBody(uintptr_t * &markMapCurrent, uintptr_t * &markMapChunkTop, uintptr_t * &markMapFreeHead, uintptr_t &heapSlotFreeCount, uintptr_t * &heapSlotFreeCurrent, uintptr_t * &heapSlotFreeHead);
 	void sweepMarkMapHead(uintptr_t *markMapFreeHead, uintptr_t *markMapChunkBase, uintptr_t * &heapSlotFreeHead, uintptr_t &heapSlotFreeCount);
 	void sweepMarkMapTail(uintptr_t *markMapCurrent, uintptr_t *markMapChunkTop, uintptr_t &heapSlotFreeCount);
+	uintptr_t sweepMarkedWords(MM_ParallelSweepChunk *sweepChunk, uintptr_t * &markMapCurrent, uintptr_t *markMapChunkTop, uintptr_t * &heapSlotFreeCurrent, uintptr_t &darkMatterCandidates, uintptr_t &darkMatterSamples, uintptr_t darkMatterSampleRate);
 
 	bool sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk);
 	void sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
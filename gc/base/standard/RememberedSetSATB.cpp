@@ -44,7 +44,7 @@ MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *w
 {
 	MM_RememberedSetSATB *rememberedSet;
 	
-	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (NULL != rememberedSet) {
 		new(rememberedSet) MM_RememberedSetSATB(env, workPackets);
 		if (!rememberedSet->initialize(env)) {
@@ -117,6 +117,7 @@ MM_RememberedSetSATB::storeInFragment(MM_EnvironmentBase* env, MM_GCRememberedSe
 {
 	if (!isFragmentValid(env, fragment)) {
 		if (!refreshFragment(env, fragment)) {
+			_workPackets->incBarrierOverflowCount();
 			_workPackets->overflowItem(env, (void *)value, OVERFLOW_TYPE_BARRIER);
 			return;
 		}
@@ -280,8 +281,8 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	MM_Packet *oldPacket = (MM_Packet *)fragment->fragmentStorage;
 		
 	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
-		_workPackets->removePacketFromInUseList(env, oldPacket);
-		_workPackets->putFullPacket(env, oldPacket);
+		/* The fragment is about to let go of the packet, so it can be published in a batch */
+		_workPackets->retireBarrierPacket(env, oldPacket);
 	}
 	
 	if (J9GC_REMEMBERED_SET_RESERVED_INDEX == fragment->localFragmentIndex) {
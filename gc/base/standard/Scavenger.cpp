@@ -30,6 +30,7 @@
 #endif
 
 #include <math.h>
+#include <new>
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -108,17 +109,6 @@
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
-/* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
- * a quick implementation
- */
-#if defined(AIXPPC) || defined(LINUXPPC)
-#define CACHE_LINE_SIZE 128
-#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
-#define CACHE_LINE_SIZE 256
-#else
-#define CACHE_LINE_SIZE 64
-#endif
-
 /* create macros to interpret the hot field descriptor */
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
@@ -234,6 +224,22 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	_scanCacheSizeLimit = _extensions->scavengerScanCacheMaximumSize;
+	_slotPrefetchDistance = OMR_MIN(_extensions->scavengerScanPrefetchDistance, SCAVENGER_SLOT_PREFETCH_FIFO_SIZE);
+
+	/* Only GC threads own a deque. With Concurrent Scavenger mutator threads produce scan work too, so it keeps using the shared scan list. */
+	if (_extensions->scavengerScanCacheStealing && !_extensions->isConcurrentScavengerEnabled()) {
+		_scanCacheDequeCount = _extensions->gcThreadCount;
+		_scanCacheDeques = (MM_CopyScanCacheDeque *)_extensions->getForge()->allocate(sizeof(MM_CopyScanCacheDeque) * _scanCacheDequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			new (&_scanCacheDeques[i]) MM_CopyScanCacheDeque();
+			_scanCacheDeques[i].setNonEmptyCount(&_nonEmptyScanCacheDequeCount);
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -309,6 +315,11 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		_extensions->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -380,6 +391,11 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		Assert_MM_true(_scanCacheDeques[i].isEmpty());
+		_scanCacheDeques[i].reset((uint32_t)((i + 1) * (_extensions->scavengerStats._gcCount + 1)));
+	}
+	_nonEmptyScanCacheDequeCount = 0;
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -782,6 +798,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_acquireScanListCount += scavStats->_acquireScanListCount;
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
+	finalGCStats->_scanCacheStealAttemptCount += scavStats->_scanCacheStealAttemptCount;
+	finalGCStats->_scanCacheStealCount += scavStats->_scanCacheStealCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
@@ -825,6 +843,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
+	finalGCStats->_scanCacheSizeLimit = OMR_MAX(finalGCStats->_scanCacheSizeLimit, scavStats->_scanCacheSizeLimit);
+	finalGCStats->_slotPrefetchIssuedCount += scavStats->_slotPrefetchIssuedCount;
+	finalGCStats->_slotPrefetchConsumedCount += scavStats->_slotPrefetchConsumedCount;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
 	finalGCStats->_syncStallTime += scavStats->_syncStallTime;
@@ -985,6 +1006,56 @@ MM_Scavenger::calcGCStats(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::updateScanCacheSizeLimit(MM_EnvironmentStandard *env)
+{
+	if (!_extensions->scavengerAdaptiveScanCacheSize) {
+		return;
+	}
+
+	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t targetCacheSize = maxCacheSize;
+
+	/* A single thread never waits for work from others, so it is best served with the largest caches */
+	if (1 < _dispatcher->activeThreadCount()) {
+		/* Average the scaling factor (share of running threads times copy/scan ratio) over the history of the cycle */
+		double scalingFactor = 1.0;
+		uintptr_t recordCount = 0;
+		MM_ScavengerCopyScanRatio::UpdateHistory *history = _extensions->copyScanRatio.getHistory(&recordCount);
+		uintptr_t validRecordCount = 0;
+		double scalingFactorSum = 0.0;
+		for (uintptr_t i = 0; i < recordCount; i++) {
+			if (0 != history[i].majorUpdates) {
+				scalingFactorSum += _extensions->copyScanRatio.getScalingFactor(env, &history[i]);
+				validRecordCount += 1;
+			}
+		}
+		if (0 != validRecordCount) {
+			scalingFactor = scalingFactorSum / (double)validRecordCount;
+		}
+
+		/* Threads out of local work that mostly fail to steal were starved, so scale down further (by up to a half) */
+		MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+		if (0 != scavengerStats->_scanCacheStealAttemptCount) {
+			double stealRate = (double)scavengerStats->_scanCacheStealCount / (double)scavengerStats->_scanCacheStealAttemptCount;
+			scalingFactor *= (1.0 + stealRate) / 2.0;
+		}
+
+		targetCacheSize = minCacheSize + (uintptr_t)((double)(maxCacheSize - minCacheSize) * scalingFactor);
+	}
+
+	/* Move a quarter of the way to the target, so that one unusual cycle does not swing the size */
+	uintptr_t cacheSizeLimit = _scanCacheSizeLimit;
+	if (targetCacheSize > cacheSizeLimit) {
+		cacheSizeLimit += (targetCacheSize - cacheSizeLimit + 3) / 4;
+	} else {
+		cacheSizeLimit -= (cacheSizeLimit - targetCacheSize) / 4;
+	}
+	cacheSizeLimit = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), cacheSizeLimit);
+	_scanCacheSizeLimit = OMR_MAX(minCacheSize, OMR_MIN(maxCacheSize, cacheSizeLimit));
+}
+
 /****************************************
  * Copy/forward routines
  ****************************************
@@ -1023,7 +1094,7 @@ MMINLINE uintptr_t
 MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 {
 	uintptr_t threadCount = _dispatcher->threadCount();
-	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t maxCacheSize = _scanCacheSizeLimit;
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
 	if (waitingThreads > 0) {
@@ -1031,7 +1102,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount();
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -1937,7 +2008,7 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	env->_scavengerStats._slotsCopied += slotsCopied;
 	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), _waitingCount, &(env->_scavengerStats._copyScanUpdates));
 	if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
@@ -1951,12 +2022,69 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 
 	if (majorFlush) {
-		_extensions->copyScanRatio.flush(env, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.flush(env, _cachedEntryCount, getApproximateScanCacheCount());
 	} else if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::scavengeObjectSlotsWithPrefetch(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	/* slots read from the scanner, in order, whose forwarding is pending, and whether their target was prefetched */
+	fomrobject_t *fifoSlots[SCAVENGER_SLOT_PREFETCH_FIFO_SIZE];
+	bool fifoPrefetched[SCAVENGER_SLOT_PREFETCH_FIFO_SIZE];
+	uintptr_t fifoHead = 0;
+	uintptr_t fifoCount = 0;
+	bool moreSlots = true;
+	bool shouldRemember = false;
+	uint64_t issuedCount = 0;
+	uint64_t consumedCount = 0;
+
+	while (moreSlots || (0 != fifoCount)) {
+		/* top up the FIFO, prefetching the targets we will have to copy or read a forwarding pointer from */
+		while (moreSlots && (fifoCount < _slotPrefetchDistance)) {
+			GC_SlotObject *slotObject = objectScanner->getNextSlot();
+			if (NULL == slotObject) {
+				moreSlots = false;
+			} else {
+				omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+				uintptr_t fifoTail = (fifoHead + fifoCount) & (SCAVENGER_SLOT_PREFETCH_FIFO_SIZE - 1);
+				fifoSlots[fifoTail] = slotObject->readAddressFromSlot();
+				fifoPrefetched[fifoTail] = (NULL != objectPtr) && isObjectInEvacuateMemory(objectPtr);
+				if (fifoPrefetched[fifoTail]) {
+					/* the header is written when the object is forwarded, the rest of the first lines is read by the copy */
+					OMR_GC_PREFETCH_WRITE(objectPtr);
+					OMR_GC_PREFETCH_READ((uintptr_t)objectPtr + CACHE_LINE_SIZE);
+					issuedCount += 1;
+				}
+				fifoCount += 1;
+			}
+		}
+
+		if (0 != fifoCount) {
+			GC_SlotObject slotObject(_omrVM, fifoSlots[fifoHead]);
+			bool prefetched = fifoPrefetched[fifoHead];
+			fifoHead = (fifoHead + 1) & (SCAVENGER_SLOT_PREFETCH_FIFO_SIZE - 1);
+			fifoCount -= 1;
+
+			shouldRemember |= copyAndForward(env, &slotObject);
+			if (NULL != env->_effectiveCopyScanCache) {
+				*slotsCopied += 1;
+				if (prefetched) {
+					consumedCount += 1;
+				}
+			}
+			*slotsScanned += 1;
+		}
+	}
+
+	env->_scavengerStats._slotPrefetchIssuedCount += issuedCount;
+	env->_scavengerStats._slotPrefetchConsumedCount += consumedCount;
+
+	return shouldRemember;
+}
+
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
@@ -2003,13 +2131,17 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	if (0 != _slotPrefetchDistance) {
+		shouldRemember = scavengeObjectSlotsWithPrefetch(env, objectScanner, &slotsScanned, &slotsCopied);
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2308,12 +2440,12 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
+ 		while (isScanWorkAvailable()) {
  			cache = getNextScanCacheFromList(env);
 
 			if (NULL != cache) {
  				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				if((0 != _waitingCount) && isScanWorkAvailable()) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -2334,7 +2466,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanWorkAvailable()) {
 				flushBuffersForGetNextScanCache(env, true);
 
 				if (shouldDoFinalNotify(env)) {
@@ -2345,7 +2477,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanWorkAvailable() && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -3565,7 +3697,10 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	/* a full deque overflows to the shared scan list */
+	if ((NULL == _scanCacheDeques) || !_scanCacheDeques[env->getWorkerID()].push(newCacheEntry)) {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3644,7 +3779,70 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	if (NULL != _scanCacheDeques) {
+		/* own work first (most recently pushed, so likely still in cache), then steal */
+		cache = _scanCacheDeques[env->getWorkerID()].pop();
+		if (NULL == cache) {
+			cache = stealScanCache(env);
+		}
+	}
+
+	if (NULL == cache) {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t victim = _scanCacheDeques[workerID].nextRandom(_scanCacheDequeCount);
+
+	for (uintptr_t i = 0; (NULL == cache) && (i < _scanCacheDequeCount); i++) {
+		MM_CopyScanCacheDeque *deque = &_scanCacheDeques[victim];
+		if ((victim != workerID) && !deque->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_scavengerStats._scanCacheStealAttemptCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			cache = deque->steal();
+		}
+		victim += 1;
+		if (victim == _scanCacheDequeCount) {
+			victim = 0;
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != cache) {
+		env->_scavengerStats._scanCacheStealCount += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return cache;
+}
+
+MMINLINE bool
+MM_Scavenger::isScanWorkAvailable()
+{
+	/* waiting threads poll this, so read one shared count rather than every thread's deque */
+	return (0 != _cachedEntryCount) || (0 != _nonEmptyScanCacheDequeCount);
+}
+
+MMINLINE uintptr_t
+MM_Scavenger::getApproximateScanCacheCount()
+{
+	uintptr_t count = _scavengeCacheScanList.getApproximateEntryCount();
+
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		count += _scanCacheDeques[i].getApproximateEntryCount();
+	}
+
+	return count;
 }
 
 /**
@@ -4065,6 +4263,12 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			/* all other GC threads are synchronized, so the deques can be drained from here */
+			for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+				while (NULL != (cache = _scanCacheDeques[i].steal())) {
+					flushCache(env, cache);
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -4199,6 +4403,9 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		mainSetupForGC(env);
 	}
 	clearIncrementGCStats(env, firstIncrement);
+	if (_extensions->scavengerAdaptiveScanCacheSize) {
+		_extensions->incrementScavengerStats._scanCacheSizeLimit = _scanCacheSizeLimit;
+	}
 	reportGCStart(env);
 	reportGCIncrementStart(env);
 	reportScavengeStart(env);
@@ -4240,6 +4447,8 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 			calculateRecommendedWorkingThreads(env);
 
+			updateScanCacheSizeLimit(env);
+
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
@@ -34,6 +34,7 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
@@ -43,6 +44,9 @@
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
 
+/* Maximum number of slots in flight in the scavengeObjectSlots prefetch pipeline (must be a power of 2) */
+#define SCAVENGER_SLOT_PREFETCH_FIFO_SIZE 8
+
 struct J9HookInterface;
 class GC_ObjectScanner;
 class MM_AllocateDescription;
@@ -108,6 +112,11 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_CopyScanCacheDeque *_scanCacheDeques; /**< per GC thread work-stealing deques of scan caches, indexed by worker ID (NULL unless scavengerScanCacheStealing is enabled) */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
+	volatile uintptr_t _nonEmptyScanCacheDequeCount; /**< number of _scanCacheDeques that may hold entries, never less than the number that do except while an owner is pushing */
+	uintptr_t _scanCacheSizeLimit; /**< upper bound for copy-scan cache sizes in the current cycle, scavengerScanCacheMaximumSize unless tuned by scavengerAdaptiveScanCacheSize */
+	uintptr_t _slotPrefetchDistance; /**< scavengerScanPrefetchDistance capped to SCAVENGER_SLOT_PREFETCH_FIFO_SIZE (0 if the prefetch pipeline is disabled) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -307,6 +316,17 @@ public:
 	 * @return Whether or not objectPtr should be remembered.
 	 */
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
+
+	/**
+	 * Copy and forward the remaining slots of an object through a small FIFO. The target of each slot is prefetched
+	 * when the slot enters the FIFO, _slotPrefetchDistance slots before the slot is forwarded.
+	 * @param env The environment.
+	 * @param objectScanner The scanner of the object, positioned at the first slot to forward.
+	 * @param slotsScanned[out] incremented by the number of slots scanned
+	 * @param slotsCopied[out] incremented by the number of slots whose target was copied
+	 * @return Whether or not any forwarded slot refers to new space.
+	 */
+	MMINLINE bool scavengeObjectSlotsWithPrefetch(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied);
 	MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);	
 	
 	/**
@@ -416,6 +436,27 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Try to take a scan cache from the deque of another GC thread. Victims are visited
+	 * round-robin starting from a randomly selected one.
+	 * @param env[in] the current GC thread
+	 * @return the stolen cache, or NULL if nothing could be stolen
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * Check if there is any scan work that a waiting thread could pick up, either from the shared scan list
+	 * or (if stealing is enabled) from a deque of any GC thread. Not synchronized, so only a hint, except
+	 * when all GC threads are waiting and no one can push new work.
+	 * @return true if scan work is available
+	 */
+	MMINLINE bool isScanWorkAvailable();
+
+	/**
+	 * @return approximate number of caches queued for scanning (shared list and all deques)
+	 */
+	MMINLINE uintptr_t getApproximateScanCacheCount();
 	/**
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
@@ -579,6 +620,14 @@ public:
 	 */
 	void calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env);
 
+	/**
+	 * Feedback controller for copy-scan cache sizes, used if scavengerAdaptiveScanCacheSize is enabled. Called at the end of each
+	 * successful scavenge, it derives a target cache size limit from the completed cycle's copy/scan ratio history (which folds in
+	 * the waiting thread counts) and scan cache steal success rate, and moves _scanCacheSizeLimit part of the way towards it.
+	 * The limit caps the sizes picked by calculateOptimumCopyScanCacheSize() in the next cycle.
+	 */
+	void updateScanCacheSizeLimit(MM_EnvironmentStandard *env);
+
 	void scavenge(MM_EnvironmentBase *env);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
@@ -924,6 +973,11 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
+		, _nonEmptyScanCacheDequeCount(0)
+		, _scanCacheSizeLimit(0)
+		, _slotPrefetchDistance(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
@@ -26,6 +26,7 @@
 #include "objectdescription.h"
 
 #include "CardTable.hpp"
+#include "Configuration.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
@@ -62,7 +63,10 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-	if (extensions->concurrentMark) {
+	/* Only the incremental update barrier has a card table; the snapshot at the beginning barrier must record
+	 * the overwritten reference before the store, which is left to the language.
+	 */
+	if (extensions->concurrentMark && extensions->configuration->isIncrementalUpdateBarrierEnabled()) {
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "SweepMarkMapKernel.hpp"
+
+#if defined(OMR_ENV_DATA64) && defined(J9HAMMER) && (defined(__GNUC__) || defined(__clang__))
+#define OMR_GC_SWEEP_AVX2_KERNEL
+#include <immintrin.h>
+#endif /* defined(OMR_ENV_DATA64) && defined(J9HAMMER) && (defined(__GNUC__) || defined(__clang__)) */
+
+/* number of words tested per iteration by the portable kernel */
+#define SWEEP_PORTABLE_UNROLL 4
+
+static uintptr_t *
+findMarkedWordPortable(uintptr_t *current, uintptr_t *top)
+{
+	while ((current + SWEEP_PORTABLE_UNROLL) <= top) {
+		if (0 != (current[0] | current[1] | current[2] | current[3])) {
+			break;
+		}
+		current += SWEEP_PORTABLE_UNROLL;
+	}
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t *
+findEmptyWordPortable(uintptr_t *current, uintptr_t *top)
+{
+	while ((current + SWEEP_PORTABLE_UNROLL) <= top) {
+		if ((0 == current[0]) || (0 == current[1]) || (0 == current[2]) || (0 == current[3])) {
+			break;
+		}
+		current += SWEEP_PORTABLE_UNROLL;
+	}
+	while ((current < top) && (0 != *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_GC_SWEEP_AVX2_KERNEL)
+/* words per 256-bit vector */
+#define SWEEP_AVX2_WORDS 4
+
+__attribute__((target("avx2"))) static uintptr_t *
+findMarkedWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	/* scalar until the vector loads are aligned */
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m256i) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+	/* two vectors (a cache line) per iteration */
+	while ((current + (2 * SWEEP_AVX2_WORDS)) <= top) {
+		__m256i words = _mm256_or_si256(_mm256_load_si256((const __m256i *)current), _mm256_load_si256((const __m256i *)(current + SWEEP_AVX2_WORDS)));
+		if (!_mm256_testz_si256(words, words)) {
+			break;
+		}
+		current += 2 * SWEEP_AVX2_WORDS;
+	}
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+findEmptyWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m256i) - 1)))) {
+		if (0 == *current) {
+			return current;
+		}
+		current += 1;
+	}
+	const __m256i zero = _mm256_setzero_si256();
+	while ((current + SWEEP_AVX2_WORDS) <= top) {
+		__m256i empty = _mm256_cmpeq_epi64(_mm256_load_si256((const __m256i *)current), zero);
+		int mask = _mm256_movemask_pd(_mm256_castsi256_pd(empty));
+		if (0 != mask) {
+			return current + __builtin_ctz((unsigned int)mask);
+		}
+		current += SWEEP_AVX2_WORDS;
+	}
+	while ((current < top) && (0 != *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+/**
+ * A processor that reports AVX2 may still run under an OS that does not save the YMM registers
+ * across context switches, so the vector kernel also needs the OS to have enabled YMM state.
+ * @return true if XCR0 has both XMM and YMM state enabled
+ */
+static bool
+isYMMStateEnabled()
+{
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	/* XCR0[2:1] = '11b' (XMM state and YMM state are enabled) */
+	return 6 == (eax & 6);
+}
+#endif /* defined(OMR_GC_SWEEP_AVX2_KERNEL) */
+
+void
+MM_SweepMarkMapKernel::initialize(MM_EnvironmentBase *env, bool allowVector)
+{
+	_findMarkedWord = findMarkedWordPortable;
+	_findEmptyWord = findEmptyWordPortable;
+
+#if defined(OMR_GC_SWEEP_AVX2_KERNEL)
+	if (allowVector) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		OMRProcessorDesc processorDescription;
+		/* xgetbv may only be executed once OSXSAVE says the OS has enabled it */
+		if ((0 == omrsysinfo_get_processor_description(&processorDescription))
+			&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+			&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)
+			&& isYMMStateEnabled()
+		) {
+			_findMarkedWord = findMarkedWordAVX2;
+			_findEmptyWord = findEmptyWordAVX2;
+		}
+	}
+#endif /* defined(OMR_GC_SWEEP_AVX2_KERNEL) */
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SWEEPMARKMAPKERNEL_HPP_)
+#define SWEEPMARKMAPKERNEL_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Mark map scanning primitives used by MM_ParallelSweepScheme to skip runs of empty (free) and
+ * non-empty (live) mark map words. The implementation is chosen once at startup: a vector kernel
+ * that tests several mark map words per instruction when the processor supports it, or a portable
+ * kernel that tests several words per iteration with plain loads.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_SweepMarkMapKernel
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Find the first mark map word in [current, top) matching the scan condition.
+	 * @param current[in] first mark map word to test
+	 * @param top[in] end of the mark map range
+	 * @return the matching word, or top if there is none
+	 */
+	typedef uintptr_t *(*ScanFunction)(uintptr_t *current, uintptr_t *top);
+
+	ScanFunction _findMarkedWord; /**< find the first word with at least one mark bit set */
+	ScanFunction _findEmptyWord; /**< find the first word with no mark bit set */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Select the kernel for the current processor.
+	 * @param env[in] the current thread
+	 * @param allowVector[in] false to force the portable kernel
+	 */
+	void initialize(MM_EnvironmentBase *env, bool allowVector);
+
+	MM_SweepMarkMapKernel()
+		: _findMarkedWord(NULL)
+		, _findEmptyWord(NULL)
+	{
+	}
+};
+
+#endif /* SWEEPMARKMAPKERNEL_HPP_ */
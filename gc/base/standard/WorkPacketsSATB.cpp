@@ -40,7 +40,7 @@ MM_WorkPacketsSATB::newInstance(MM_EnvironmentBase *env)
 {
 	MM_WorkPacketsSATB *workPackets;
 	
-	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (workPackets) {
 		new(workPackets) MM_WorkPacketsSATB(env);
 		if (!workPackets->initialize(env)) {
@@ -67,6 +67,8 @@ MM_WorkPacketsSATB::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	_publishBatchSize = OMR_MAX(env->getExtensions()->satbPacketPublishBatchSize, 1);
+
 	return true;
 }
 
@@ -100,7 +102,7 @@ MM_WorkPacketsSATB::getBarrierPacket(MM_EnvironmentBase *env)
 	MM_Packet *barrierPacket = NULL;
 
 	/* Check the free list */
-	barrierPacket = getPacket(env, &_emptyPacketList);
+	barrierPacket = getEmptyPacket(env);
 	if(NULL != barrierPacket) {
 		return barrierPacket;
 	}
@@ -141,7 +143,7 @@ MM_WorkPacketsSATB::getPacketByOverflowing(MM_EnvironmentBase *env)
 		/* Try again to get a packet off of the emptyPacketList as another thread
 		 * may have emptied a packet.
 		 */
-		packet = getPacket(env, &_emptyPacketList);
+		packet = getEmptyPacket(env);
 	}
 
 	return packet;
@@ -169,6 +171,41 @@ MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	_fullPacketList.push(env, packet);
 }
 
+/**
+ * Retire a full barrier packet which has just been detached from its fragment.
+ * Rather than paying for a removal from the inUse list and a push on the full list
+ * on every fragment refresh, the packet is tagged as returned and left where it is.
+ * Every _publishBatchSize retirements the retired packets are published to markers
+ * in one batch. Retired packets are still drained by moveInUseToNonEmpty().
+ * @param packet the full packet which is no longer referenced by any fragment
+ */
+void
+MM_WorkPacketsSATB::retireBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	packet->resetOwner();
+	uintptr_t retired = MM_AtomicOperations::add(&_retiredBarrierPacketCount, 1);
+	if (0 == (retired % _publishBatchSize)) {
+		publishRetiredBarrierPackets(env);
+	}
+}
+
+/**
+ * Move all retired packets from the inUse list to the full list with a single push.
+ */
+void
+MM_WorkPacketsSATB::publishRetiredBarrierPackets(MM_EnvironmentBase *env)
+{
+	MM_Packet *head = NULL;
+	MM_Packet *tail = NULL;
+	uintptr_t count = _inUseBarrierPacketList.removeReturned(&head, &tail);
+
+	if (0 != count) {
+		_fullPacketList.pushList(head, tail, count);
+		MM_AtomicOperations::add(&_publishedBarrierPacketCount, count);
+		MM_AtomicOperations::add(&_barrierPublishCount, 1);
+	}
+}
+
 /**
  * Move all of the packets from the inUse list to the processing list
  * so they are available for processing.
@@ -216,7 +253,7 @@ MM_WorkPacketsSATB::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 	 * while(!_overflowHandler->isEmpty()) {
 	 */
 	if(!_overflowHandler->isEmpty()) {
-		if(NULL != (overflowPacket = getPacket(env, &_emptyPacketList))) {
+		if(NULL != (overflowPacket = getEmptyPacket(env))) {
 
 			_overflowHandler->fillFromOverflow(env, overflowPacket);
 
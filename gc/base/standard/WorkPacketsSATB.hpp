@@ -26,6 +26,7 @@
 
 #if defined(OMR_GC_REALTIME)
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "WorkPackets.hpp"
 
@@ -35,6 +36,11 @@ class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
 	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	uintptr_t _publishBatchSize; /**< Number of retired barrier packets which triggers a publication to the full list */
+	volatile uintptr_t _retiredBarrierPacketCount; /**< Running count of barrier packets retired on the in use list */
+	volatile uintptr_t _barrierOverflowCount; /**< Number of barrier entries sent to overflow because no packet was available */
+	volatile uintptr_t _publishedBarrierPacketCount; /**< Number of full barrier packets published to markers */
+	volatile uintptr_t _barrierPublishCount; /**< Number of batched publications of full barrier packets */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -52,14 +58,38 @@ public:
 	virtual void removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 
+	void retireBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	void publishRetiredBarrierPackets(MM_EnvironmentBase *env);
+
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
+	MMINLINE void incBarrierOverflowCount() { MM_AtomicOperations::add(&_barrierOverflowCount, 1); }
+	MMINLINE uintptr_t getBarrierOverflowCount() { return _barrierOverflowCount; }
+	MMINLINE uintptr_t getPublishedBarrierPacketCount() { return _publishedBarrierPacketCount; }
+	MMINLINE uintptr_t getBarrierPublishCount() { return _barrierPublishCount; }
+
+	/**
+	 * Clear the barrier handoff statistics once they have been reported for a cycle
+	 */
+	MMINLINE void
+	resetBarrierStats()
+	{
+		_barrierOverflowCount = 0;
+		_publishedBarrierPacketCount = 0;
+		_barrierPublishCount = 0;
+	}
+
 	/**
 	 * Create a MM_WorkPacketsRealtime object.
 	 */
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
 		, _inUseBarrierPacketList(NULL)
+		, _publishBatchSize(1)
+		, _retiredBarrierPacketCount(0)
+		, _barrierOverflowCount(0)
+		, _publishedBarrierPacketCount(0)
+		, _barrierPublishCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -70,6 +70,10 @@ class MM_ConcurrentGCStats : public MM_Base
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
+
+	uintptr_t _satbBarrierOverflowCount; /**< SATB barrier entries sent to overflow because no barrier packet was available */
+	uintptr_t _satbPacketsPublished; /**< Full SATB barrier packets handed to markers */
+	uintptr_t _satbPublishCount; /**< Batched publications used to hand over _satbPacketsPublished */
 	
 	volatile uint32_t _completedModes; /**< a bit mask of modes which have been completed in the current cycle */
 	
@@ -174,6 +178,16 @@ public:
 	MMINLINE bool getConcurrentWorkStackOverflowOcurred() { return _concurrentWorkStackOverflowOcurred; };
 	MMINLINE void setConcurrentWorkStackOverflowOcurred(bool overflow){ _concurrentWorkStackOverflowOcurred = overflow; };
 	MMINLINE uintptr_t getConcurrentWorkStackOverflowCount() { return _concurrentWorkStackOverflowCount; };
+
+	MMINLINE uintptr_t getSATBBarrierOverflowCount() { return _satbBarrierOverflowCount; };
+	MMINLINE uintptr_t getSATBPacketsPublished() { return _satbPacketsPublished; };
+	MMINLINE uintptr_t getSATBPublishCount() { return _satbPublishCount; };
+	MMINLINE void setSATBBarrierStats(uintptr_t overflowCount, uintptr_t packetsPublished, uintptr_t publishCount)
+	{
+		_satbBarrierOverflowCount = overflowCount;
+		_satbPacketsPublished = packetsPublished;
+		_satbPublishCount = publishCount;
+	};
 		
 	/* Functions required to perform atomic updates of concurrent statistics */
 	MMINLINE void incrementCount(uintptr_t *count, uintptr_t increment) 
@@ -227,6 +241,9 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		_satbBarrierOverflowCount = 0;
+		_satbPacketsPublished = 0;
+		_satbPublishCount = 0;
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -262,6 +279,9 @@ public:
 		_threadsToScanCount(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
+		_satbBarrierOverflowCount(0),
+		_satbPacketsPublished(0),
+		_satbPublishCount(0),
 		_completedModes(0),
 		_kickoffReason(NO_KICKOFF_REASON),
 		_cardCleaningReason(CARD_CLEANING_REASON_NONE)
@@ -22,6 +22,11 @@
 
 #include "HeapResizeStats.hpp"
 
+#include "Math.hpp"
+
+/* Weight of the previous cost model constant when a new global collection is recorded */
+#define GC_COST_MODEL_HISTORY_WEIGHT ((float)0.5)
+
 uint32_t
 MM_HeapResizeStats::calculateGCPercentage() 
 {
@@ -89,3 +94,32 @@ MM_HeapResizeStats::updateHeapResizeStats()
 		updateRatioTicks(timeInGC, timeOutsideGC);
 	}			
 }	
+
+void
+MM_HeapResizeStats::updateGCCostModel(uint32_t gcPercentage, uintptr_t freeBytes)
+{
+	/* A collection that freed nothing, or whose cost is not known yet, says nothing about the model */
+	if ((0 < gcPercentage) && (0 < freeBytes)) {
+		float constant = (float)gcPercentage * ((float)freeBytes / (float)(1024 * 1024));
+		if (isGCCostModelValid()) {
+			_gcCostModelConstant = MM_Math::weightedAverage(_gcCostModelConstant, constant, GC_COST_MODEL_HISTORY_WEIGHT);
+		} else {
+			_gcCostModelConstant = constant;
+		}
+	}
+}
+
+uintptr_t
+MM_HeapResizeStats::predictFreeBytesForGCPercentage(uintptr_t gcPercentage)
+{
+	if (!isGCCostModelValid()) {
+		return 0;
+	}
+
+	/* A target of 0% is unreachable; size for the smallest non zero percentage instead */
+	float freeMB = _gcCostModelConstant / (float)OMR_MAX(gcPercentage, 1);
+	if (freeMB >= (float)(UDATA_MAX / (1024 * 1024))) {
+		return UDATA_MAX;
+	}
+	return (uintptr_t)(freeMB * (float)(1024 * 1024));
+}
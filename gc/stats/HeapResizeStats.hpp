@@ -71,6 +71,8 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	float					_gcCostModelConstant; /**< weighted average of GC time percentage multiplied by free MB after a global GC (0 until measured) */
+
 protected:
 public:
 
@@ -85,6 +87,25 @@ public:
 
 	void	updateHeapResizeStats();
 
+	/**
+	 * Refine the GC cost model from a completed global collection.
+	 * The model takes the time spent in GC to be inversely proportional to the memory free after a
+	 * collection: every collection costs about the same for a given live set, and collections are
+	 * as frequent as allocation exhausts the free memory.
+	 * @param gcPercentage[in] the percentage of time recently spent in GC (0 if not yet known)
+	 * @param freeBytes[in] the bytes free after the collection
+	 */
+	void	updateGCCostModel(uint32_t gcPercentage, uintptr_t freeBytes);
+
+	/**
+	 * @return the bytes that must be free after a global collection for the modelled GC time
+	 * percentage to meet gcPercentage, or 0 if the model has not been measured yet
+	 */
+	uintptr_t	predictFreeBytesForGCPercentage(uintptr_t gcPercentage);
+
+	MMINLINE bool	isGCCostModelValid() { return 0.0f < _gcCostModelConstant; }
+	MMINLINE void	resetGCCostModel() { _gcCostModelConstant = 0.0f; }
+
 	MMINLINE void 	resetRatioTicks()
 	{
 		for (int i = 0; i < RATIO_RESIZE_HISTORIES; i++)
@@ -196,7 +217,8 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_gcCostModelConstant(0.0f)
 	{
 		resetRatioTicks();
 	}
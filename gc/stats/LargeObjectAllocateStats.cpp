@@ -201,6 +201,9 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+	_freeListSearchCount = 0;
+	_freeListWalkLength = 0;
+	_freeListWalkLengthMax = 0;
 }
 
 void
@@ -248,6 +251,11 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	/* merge free list walk lengths - current */
+	_freeListSearchCount += statsToMerge->_freeListSearchCount;
+	_freeListWalkLength += statsToMerge->_freeListWalkLength;
+	_freeListWalkLengthMax = OMR_MAX(_freeListWalkLengthMax, statsToMerge->_freeListWalkLengthMax);
 }
 
 void
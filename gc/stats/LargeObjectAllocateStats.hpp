@@ -74,6 +74,9 @@ private:
 
 	uintptr_t _TLHSizeClassIndex; /**< preserved next value of sizeClassIndex on last invocation of simulateAllocateTLHs */
 	uintptr_t _TLHFrequentAllocationSize;/**< preserved next value of FrequentAllocationSize on last invocation of simulateAllocateTLHs */
+	uintptr_t _freeListSearchCount; /**< number of free list searches made for object allocates (current) */
+	uintptr_t _freeListWalkLength; /**< total number of free entries walked by those searches (current) */
+	uintptr_t _freeListWalkLengthMax; /**< longest single free list walk (current) */
 
 	MMINLINE uintptr_t getNextSizeClass(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 	MMINLINE bool isFirstIterationCompleteForCurrentStride(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
@@ -128,6 +131,19 @@ public:
 	 */
 	void allocateObject(uintptr_t allocateSize);
 
+	/**
+	 * Invoked by allocator to notify about a free list search, whether it succeeded or not.
+	 * @param walkLength number of free entries that were walked and found too small
+	 */
+	MMINLINE void recordFreeListWalk(uintptr_t walkLength)
+	{
+		_freeListSearchCount += 1;
+		_freeListWalkLength += walkLength;
+		if (walkLength > _freeListWalkLengthMax) {
+			_freeListWalkLengthMax = walkLength;
+		}
+	}
+
 	/**
 	 * Merge CURRENT this/these stats with provided stats. The result is stored back into this stats
      * @param statsToMerge to be added to this stats
@@ -219,6 +235,9 @@ public:
 	void resetRemainingFreeMemoryAfterEstimate() { _remainingFreeMemoryAfterEstimate= 0; }
 	uintptr_t getFreeMemoryBeforeEstimate() { return _freeMemoryBeforeEstimate; }
 	uintptr_t getMaxHeapSize() {return _maxHeapSize; }
+	uintptr_t getFreeListSearchCount() { return _freeListSearchCount; }
+	uintptr_t getFreeListWalkLength() { return _freeListWalkLength; }
+	uintptr_t getFreeListWalkLengthMax() { return _freeListWalkLengthMax; }
 	uintptr_t getFreeMemory(){return _freeEntrySizeClassStats.getFreeMemory(_sizeClassSizes);}
 	uintptr_t getPageAlignedFreeMemory(uintptr_t pageSize) {return _freeEntrySizeClassStats.getPageAlignedFreeMemory(_sizeClassSizes, pageSize);}
 
@@ -247,7 +266,10 @@ public:
 		_freeMemoryBeforeEstimate(0),
 		_maxHeapSize(0),
 		_TLHSizeClassIndex(0),
-		_TLHFrequentAllocationSize(0)
+		_TLHFrequentAllocationSize(0),
+		_freeListSearchCount(0),
+		_freeListWalkLength(0),
+		_freeListWalkLengthMax(0)
 	{
 	}
 
@@ -52,6 +52,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_releaseFreeListCount(0)
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
+	,_scanCacheStealAttemptCount(0)
+	,_scanCacheStealCount(0)
 	,_aliasToCopyCacheCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
@@ -93,6 +95,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_scanCacheSizeLimit(0)
+	,_slotPrefetchIssuedCount(0)
+	,_slotPrefetchConsumedCount(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -164,6 +169,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_releaseFreeListCount = 0;
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
+	_scanCacheStealAttemptCount = 0;
+	_scanCacheStealCount = 0;
 	_aliasToCopyCacheCount = 0;
 	_arraySplitCount = 0;
 	_arraySplitAmount = 0;
@@ -211,6 +218,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
+	_scanCacheSizeLimit = 0;
+	_slotPrefetchIssuedCount = 0;
+	_slotPrefetchConsumedCount = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
 }
@@ -84,6 +84,8 @@ public:
 	uintptr_t _releaseFreeListCount;
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
+	uintptr_t _scanCacheStealAttemptCount; /**< number of times the thread tried to steal a scan cache from a non-empty deque of another thread */
+	uintptr_t _scanCacheStealCount; /**< number of scan caches successfully stolen from other threads' deques */
 	uintptr_t _aliasToCopyCacheCount;
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
@@ -148,6 +150,9 @@ public:
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
+	uintptr_t _scanCacheSizeLimit; /**< copy-scan cache size limit picked by the adaptive cache size controller for this cycle (0 if the controller is disabled) */
+	uint64_t _slotPrefetchIssuedCount; /**< number of slot targets prefetched ahead of their copy and forward by the scan prefetch pipeline */
+	uint64_t _slotPrefetchConsumedCount; /**< number of prefetched slot targets that were then copied, so the copy read the prefetched lines (the others had been forwarded meanwhile) */
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
@@ -246,6 +251,20 @@ public:
 		_copy_cachesize_sum += copyCacheSize;
 	}
 
+	/**
+	 * Get the average size of the copy-scan caches requested during the collection
+	 * @return the average size in bytes (0 if no cache was requested)
+	 */
+	MMINLINE uintptr_t
+	getAverageCopyCacheSize()
+	{
+		uint64_t count = 0;
+		for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
+			count += _copy_cachesize_counts[i];
+		}
+		return (0 == count) ? 0 : (uintptr_t)(_copy_cachesize_sum / count);
+	}
+
 	void clear(bool firstIncrement);
 	
 	/**
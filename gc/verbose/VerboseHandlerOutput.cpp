@@ -29,6 +29,10 @@
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutput.hpp"
@@ -315,10 +319,21 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"workPacketsLockFree\" value=\"%s\" />", _extensions->workPacketsLockFree ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"markingArraySplitThreshold\" value=\"%zu\" />", _extensions->markingArraySplitThreshold);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	if (_extensions->isConcurrentMarkEnabled()) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"concurrentPacing\" value=\"%s\" />", _extensions->concurrentPacing ? "true" : "false");
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"scanCacheStealing\" value=\"%s\" />", _extensions->scavengerScanCacheStealing ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerScanPrefetchDistance\" value=\"%zu\" />", _extensions->scavengerScanPrefetchDistance);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerAdaptiveScanCacheSize\" value=\"%s\" />", _extensions->scavengerAdaptiveScanCacheSize ? "true" : "false");
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListTryLock\" value=\"%s\" />", _extensions->splitFreeListTryLock ? "true" : "false");
 	buffer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
 
 	outputInitializedInnerStanza(env, buffer);
@@ -815,6 +830,11 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		MM_LargeObjectAllocateStats *tenureStats = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool()->getLargeObjectAllocateStats();
+		if (NULL != tenureStats) {
+			writer->formatAndOutput(env, 1, "<free-list-walk searches=\"%zu\" entriesWalked=\"%zu\" longestWalk=\"%zu\" />",
+					tenureStats->getFreeListSearchCount(), tenureStats->getFreeListWalkLength(), tenureStats->getFreeListWalkLengthMax());
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -0,0 +1,507 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+/* Size of the record ring, a power of two; a collection rarely produces more than a few kilobytes */
+#define VERBOSE_ASYNCHRONOUS_RING_SIZE ((uintptr_t)512 * 1024)
+/* How long an idle flusher sleeps before checking for records nobody notified it about */
+#define VERBOSE_ASYNCHRONOUS_FLUSH_INTERVAL_MILLIS 100
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_logFileStream(NULL)
+	,_omrVM(NULL)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_reserved(0)
+	,_consumed(0)
+	,_flusherMonitor(NULL)
+	,_flusherState(FLUSHER_NONE)
+	,_activeProducers(0)
+	,_droppedOutputCount(0)
+	,_reportedDroppedCount(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance and starts the flusher thread.
+ * If the flusher can not be started, output is written synchronously instead.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_omrVM = env->getOmrVM();
+
+	if (NULL == _ring) {
+		_ring = (uint8_t *)extensions->getForge()->allocate(VERBOSE_ASYNCHRONOUS_RING_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		_ringSize = VERBOSE_ASYNCHRONOUS_RING_SIZE;
+		memset(_ring, 0, _ringSize);
+	}
+
+	if (NULL == _flusherMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_flusherMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_flusherMonitor")) {
+			_flusherMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	startFlusher(env);
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the flusher thread, writing any records still in the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _flusherMonitor) {
+		stopFlusher(env);
+		omrthread_monitor_destroy(_flusherMonitor);
+		_flusherMonitor = NULL;
+	}
+
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * Called from the flusher thread when the file is rotated.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfilestream_printf(_logFileStream, getHeader(env), version);
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			/* the stanza belongs before anything still queued, so it bypasses the ring */
+			writeString(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)), J9STR_CODE_PLATFORM_RAW);
+		omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(NULL != _logFileStream){
+		omrfilestream_write_text(_logFileStream, string, length, J9STR_CODE_PLATFORM_RAW);
+	} else {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+
+	if (0 < length) {
+		produce(env, RECORD_TEXT, string, length);
+	}
+}
+
+/**
+ * Queues the end of cycle so that file rotation happens on the flusher thread, after the
+ * output of the cycle has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	produce(env, RECORD_END_OF_CYCLE, NULL, 0);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	stopFlusher(env);
+	closeFile(env);
+	return initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Writes everything still queued and closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	stopFlusher(env);
+	closeFile(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::produce(MM_EnvironmentBase *env, RecordType type, const char *data, uintptr_t length)
+{
+	omrthread_monitor_enter(_flusherMonitor);
+	while ((FLUSHER_RUNNING != _flusherState) && (FLUSHER_NONE != _flusherState)) {
+		omrthread_monitor_wait(_flusherMonitor);
+	}
+
+	if (FLUSHER_NONE == _flusherState) {
+		/* no flusher thread, so write here; holding the monitor keeps a flusher from starting meanwhile */
+		if (RECORD_TEXT == type) {
+			writeString(env, data, length);
+		} else {
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+		omrthread_monitor_exit(_flusherMonitor);
+		return;
+	}
+
+	/* the flusher does its final drain only once every producer that saw it running has finished its records */
+	_activeProducers += 1;
+	omrthread_monitor_exit(_flusherMonitor);
+
+	if (!enqueueRecords(type, data, length)) {
+		MM_AtomicOperations::add(&_droppedOutputCount, 1);
+	}
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_activeProducers -= 1;
+	if ((RECORD_END_OF_CYCLE == type) || (FLUSHER_TERMINATION_REQUESTED == _flusherState)) {
+		omrthread_monitor_notify_all(_flusherMonitor);
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueueRecords(RecordType type, const char *data, uintptr_t length)
+{
+	/* Split long output so a single record can never need more than the ring holds */
+	uintptr_t maximumChunk = _ringSize / 4;
+	uintptr_t fullChunks = length / maximumChunk;
+	uintptr_t rest = length % maximumChunk;
+	uintptr_t size = (fullChunks * recordSize(maximumChunk)) + (((0 == rest) && (0 < fullChunks)) ? 0 : recordSize(rest));
+
+	/* Reserve every record at once, so a string is either logged whole or dropped whole */
+	uintptr_t cursor = 0;
+	do {
+		cursor = _reserved;
+		/* the consumed cursor only moves forward, so a stale read is conservative */
+		if ((cursor + size - _consumed) > _ringSize) {
+			return false;
+		}
+	} while (cursor != MM_AtomicOperations::lockCompareExchange(&_reserved, cursor, cursor + size));
+
+	do {
+		uintptr_t chunk = OMR_MIN(length, maximumChunk);
+		/* Records are aligned to the header size and the ring size is a multiple of it, so a header never wraps */
+		RecordHeader *header = (RecordHeader *)(_ring + (cursor & (_ringSize - 1)));
+		copyToRing(cursor + sizeof(RecordHeader), data, chunk);
+		header->length = (uint32_t)chunk;
+		MM_AtomicOperations::storeSync();
+		header->type = (uint32_t)type;
+		cursor += recordSize(chunk);
+		data += chunk;
+		length -= chunk;
+	} while (0 < length);
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::copyToRing(uintptr_t cursor, const char *data, uintptr_t length)
+{
+	uintptr_t offset = cursor & (_ringSize - 1);
+	uintptr_t firstLength = OMR_MIN(length, _ringSize - offset);
+
+	memcpy(_ring + offset, data, firstLength);
+	if (firstLength < length) {
+		memcpy(_ring, data + firstLength, length - firstLength);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeFromRing(MM_EnvironmentBase *env, uintptr_t cursor, uintptr_t length)
+{
+	uintptr_t offset = cursor & (_ringSize - 1);
+	uintptr_t firstLength = OMR_MIN(length, _ringSize - offset);
+
+	writeString(env, (const char *)(_ring + offset), firstLength);
+	if (firstLength < length) {
+		writeString(env, (const char *)_ring, length - firstLength);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::clearRing(uintptr_t cursor, uintptr_t length)
+{
+	uintptr_t offset = cursor & (_ringSize - 1);
+	uintptr_t firstLength = OMR_MIN(length, _ringSize - offset);
+
+	memset(_ring + offset, 0, firstLength);
+	if (firstLength < length) {
+		memset(_ring, 0, length - firstLength);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::drainRecords(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	bool consumedRecord = false;
+
+	while (_consumed != _reserved) {
+		uintptr_t cursor = _consumed;
+		RecordHeader *header = (RecordHeader *)(_ring + (cursor & (_ringSize - 1)));
+		uint32_t type = header->type;
+		if (0 == type) {
+			/* the producer has reserved this record but not finished writing it */
+			break;
+		}
+		MM_AtomicOperations::readBarrier();
+
+		uintptr_t droppedCount = _droppedOutputCount;
+		if (droppedCount != _reportedDroppedCount) {
+			/* records complete in the ring were produced after the drops, so the warning goes before them */
+			char warning[128];
+			uintptr_t warningLength = (uintptr_t)omrstr_printf(warning, sizeof(warning), "<warning details=\"%zu verbose output records dropped, the asynchronous log ring was full\" />\n", droppedCount - _reportedDroppedCount);
+			writeString(env, warning, warningLength);
+			_reportedDroppedCount = droppedCount;
+		}
+
+		uintptr_t length = header->length;
+		if (RECORD_TEXT == type) {
+			writeFromRing(env, cursor + sizeof(RecordHeader), length);
+		} else {
+			Assert_MM_true(RECORD_END_OF_CYCLE == type);
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+
+		/* A later record header may land anywhere in this one, so it must read as incomplete */
+		uintptr_t size = recordSize(length);
+		clearRing(cursor, size);
+		MM_AtomicOperations::storeSync();
+		_consumed = cursor + size;
+		consumedRecord = true;
+	}
+
+	return consumedRecord;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startFlusher(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not report its state before we wait */
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		flusher_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (FLUSHER_STARTING == _flusherState) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		success = (FLUSHER_RUNNING == _flusherState);
+	} else {
+		_flusherState = FLUSHER_NONE;
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopFlusher(MM_EnvironmentBase *env)
+{
+	/* tell the flusher to shut down and then wait for it to write the remaining records and exit */
+	omrthread_monitor_enter(_flusherMonitor);
+	if (FLUSHER_NONE != _flusherState) {
+		while (FLUSHER_TERMINATED != _flusherState) {
+			_flusherState = FLUSHER_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_flusherMonitor);
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		/* producers waiting for the flusher to stop write directly from now on */
+		_flusherState = FLUSHER_NONE;
+		omrthread_monitor_notify_all(_flusherMonitor);
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::flusher_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->flusherEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flusherEntryPoint()
+{
+	{
+		/* The flusher only writes files, so it runs without a VM thread */
+		MM_EnvironmentBase env(_omrVM);
+
+		omrthread_monitor_enter(_flusherMonitor);
+		_flusherState = FLUSHER_RUNNING;
+		omrthread_monitor_notify_all(_flusherMonitor);
+
+		while (FLUSHER_TERMINATION_REQUESTED != _flusherState) {
+			omrthread_monitor_exit(_flusherMonitor);
+			bool consumedRecord = drainRecords(&env);
+			omrthread_monitor_enter(_flusherMonitor);
+			if (!consumedRecord && (FLUSHER_TERMINATION_REQUESTED != _flusherState)) {
+				omrthread_monitor_wait_timed(_flusherMonitor, VERBOSE_ASYNCHRONOUS_FLUSH_INTERVAL_MILLIS, 0);
+			}
+		}
+
+		/* producers that saw the flusher running may still be writing records */
+		while (0 != _activeProducers) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		omrthread_monitor_exit(_flusherMonitor);
+
+		drainRecords(&env);
+	}
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_TERMINATED;
+	omrthread_monitor_notify_all(_flusherMonitor);
+	omrthread_exit(_flusherMonitor);
+}
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a background flusher thread.
+ *
+ * Output produced during a collection is copied into a ring of length prefixed records, so the
+ * only cost left on the collecting thread is a reservation and a copy. The flusher thread writes
+ * the records to file in order and performs file rotation when it reaches an end of cycle record.
+ * Producers never wait for the flusher: output that does not fit in the ring is dropped and counted,
+ * and the flusher reports the drops in the log with a warning.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Header of a record in the ring. The type is written last, so a non-zero type tells the
+	 * flusher that the record is complete.
+	 */
+	struct RecordHeader {
+		uint32_t length; /**< payload bytes following the header */
+		uint32_t type; /**< one of RecordType, or 0 while the record is being written */
+	};
+
+	enum RecordType {
+		RECORD_TEXT = 1, /**< payload is verbose output to write to file */
+		RECORD_END_OF_CYCLE /**< no payload, rotate the file if required */
+	};
+
+	enum FlusherState {
+		FLUSHER_NONE = 0, /**< no flusher thread, output is written synchronously */
+		FLUSHER_STARTING,
+		FLUSHER_RUNNING,
+		FLUSHER_TERMINATION_REQUESTED,
+		FLUSHER_TERMINATED
+	};
+
+	OMRFileStream *_logFileStream; /**< the filestream being written to */
+	OMR_VM *_omrVM; /**< the VM the flusher thread writes for */
+
+	uint8_t *_ring; /**< record storage, _ringSize bytes */
+	uintptr_t _ringSize; /**< size of the ring in bytes, a power of two */
+	volatile uintptr_t _reserved; /**< total bytes ever reserved by producers */
+	volatile uintptr_t _consumed; /**< total bytes ever released by the flusher */
+
+	omrthread_monitor_t _flusherMonitor; /**< protects _flusherState and _activeProducers, and wakes the flusher */
+	volatile FlusherState _flusherState; /**< lifecycle of the flusher thread */
+	uintptr_t _activeProducers; /**< producers that saw the flusher running and may still be writing records */
+
+	volatile uintptr_t _droppedOutputCount; /**< number of output strings and end of cycle records dropped because the ring was full */
+	uintptr_t _reportedDroppedCount; /**< drops already reported in the log, used only by the flusher */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getDroppedOutputCount() { return _droppedOutputCount; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Write text directly to the file, bypassing the ring.
+	 */
+	void writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+
+	bool startFlusher(MM_EnvironmentBase *env);
+	void stopFlusher(MM_EnvironmentBase *env);
+
+	/**
+	 * Hand a record to the flusher, or write it directly if there is no flusher thread.
+	 * Waits while the flusher is starting or stopping, so output is never written by two threads at once.
+	 * @param type[in] the record type
+	 * @param data[in] the payload, may be NULL when length is 0
+	 * @param length[in] payload bytes
+	 */
+	void produce(MM_EnvironmentBase *env, RecordType type, const char *data, uintptr_t length);
+
+	/**
+	 * Append the payload to the ring as one or more records, reserving the space for all of them at once.
+	 * @param type[in] the record type
+	 * @param data[in] the payload, may be NULL when length is 0
+	 * @param length[in] payload bytes, split into records of at most a quarter of the ring
+	 * @return false if the ring has no room for the records, in which case nothing was appended
+	 */
+	bool enqueueRecords(RecordType type, const char *data, uintptr_t length);
+
+	/**
+	 * Write and release every complete record at the head of the ring.
+	 * Called only from the flusher thread, or after it has terminated.
+	 * @return true if any record was consumed
+	 */
+	bool drainRecords(MM_EnvironmentBase *env);
+
+	void copyToRing(uintptr_t cursor, const char *data, uintptr_t length);
+	void writeFromRing(MM_EnvironmentBase *env, uintptr_t cursor, uintptr_t length);
+	void clearRing(uintptr_t cursor, uintptr_t length);
+
+	MMINLINE uintptr_t recordSize(uintptr_t length) { return sizeof(RecordHeader) + ((length + sizeof(RecordHeader) - 1) & ~(sizeof(RecordHeader) - 1)); }
+
+	void flusherEntryPoint();
+	static int J9THREAD_PROC flusher_thread_proc(void *info);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
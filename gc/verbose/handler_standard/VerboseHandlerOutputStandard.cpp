@@ -26,6 +26,7 @@
 #include "gcutils.h"
 
 #include "ConcurrentGCStats.hpp"
+#include "Configuration.hpp"
 #include "ConcurrentMarkPhaseStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
@@ -72,6 +73,7 @@ static void verboseHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t ev
 static void verboseHandlerConcurrentHalted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 MM_VerboseHandlerOutput *
@@ -151,6 +153,7 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PACING, verboseHandlerConcurrentPacing, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_END, verboseHandlerConcurrentRememberedSetScanEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
@@ -210,6 +213,7 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PACING, verboseHandlerConcurrentPacing, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_END, verboseHandlerConcurrentRememberedSetScanEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
@@ -430,6 +434,20 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->scavengerScanCacheStealing) {
+		writer->formatAndOutput(env, 1, "<scan-cache-steal attempts=\"%zu\" stolen=\"%zu\" />",
+				scavengerStats->_scanCacheStealAttemptCount, scavengerStats->_scanCacheStealCount);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	if (0 != scavengerStats->_scanCacheSizeLimit) {
+		writer->formatAndOutput(env, 1, "<scan-cache-size limit=\"%zu\" average=\"%zu\" />",
+				scavengerStats->_scanCacheSizeLimit, scavengerStats->getAverageCopyCacheSize());
+	}
+	if (0 != extensions->scavengerScanPrefetchDistance) {
+		writer->formatAndOutput(env, 1, "<slot-prefetch issued=\"%llu\" consumed=\"%llu\" />",
+				scavengerStats->_slotPrefetchIssuedCount, scavengerStats->_slotPrefetchConsumedCount);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -532,6 +550,9 @@ MM_VerboseHandlerOutputStandard::handleConcurrentMarkEnd(J9HookInterface** hook,
 
 	handleGCOPOuterStanzaStart(env, "trace", stats->_cycleID, duration, deltaTimeSuccess);
 	writer->formatAndOutput(env, 1, "<trace bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />", (collectionStats->getConHelperTraceSizeCount() + collectionStats->getTraceSizeCount()), collectionStats->getConcurrentWorkStackOverflowCount());
+	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
+		writer->formatAndOutput(env, 1, "<satb-barrier overflowCount=\"%zu\" packetsPublished=\"%zu\" publications=\"%zu\" />", collectionStats->getSATBBarrierOverflowCount(), collectionStats->getSATBPacketsPublished(), collectionStats->getSATBPublishCount());
+	}
 	if (0 == stats->_cardTableStats->getConcurrentCleanedCards()) {
 		writer->formatAndOutput(env, 1, "<card-cleaning bytesTraced=\"%zu\" cardsCleaned=\"%zu\" />", (collectionStats->getConHelperCardCleanCount() + collectionStats->getCardCleanCount()), stats->_cardTableStats->getConcurrentCleanedCards());
 	} else {
@@ -851,6 +872,48 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 {
 	/* Empty stub */
 }
+
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ConcurrentPacingEvent* event = (MM_ConcurrentPacingEvent*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[100];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-pacing %s>", tagTemplate);
+
+	const char* outcome;
+	switch((ConcurrentPacingOutcome)event->outcome) {
+	case CONCURRENT_PACING_NO_FEEDBACK:
+		outcome = "none";
+		break;
+	case CONCURRENT_PACING_COMPLETED_EARLY:
+		outcome = "completed early";
+		break;
+	case CONCURRENT_PACING_COMPLETED_ON_TIME:
+		outcome = "completed on time";
+		break;
+	case CONCURRENT_PACING_NOT_COMPLETED:
+		outcome = "not completed";
+		break;
+	default:
+		outcome = "unknown";
+		break;
+	}
+
+	writer->formatAndOutput(env, 1, "<last-cycle outcome=\"%s\" freeAtExhausted=\"%zu\" unfinishedBytes=\"%zu\" />", outcome, event->freeAtExhausted, event->unfinishedWork);
+	writer->formatAndOutput(env, 1, "<rates allocatedBytesPerMs=\"%.1f\" helperTracedBytesPerMs=\"%.1f\" />", event->allocationRate, event->conHelperTraceRate);
+	writer->formatAndOutput(env, 1, "<timing exhaustionMs=\"%.1f\" helperTraceMs=\"%.1f\" />", event->exhaustionTime, event->helperTraceTime);
+	writer->formatAndOutput(env, 1, "<next-kickoff factor=\"%.3f\" thresholdFreeBytes=\"%zu\" />", event->kickoffFactor, event->kickOffThreshold);
+	writer->formatAndOutput(env, 0, "</concurrent-pacing>");
+	writer->flush(env);
+
+	exitAtomicReportingBlock();
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 bool
@@ -1123,6 +1186,12 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 {
 	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentAborted(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentPacing(hook, eventNum, eventData);
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 void
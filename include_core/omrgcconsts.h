@@ -359,6 +359,19 @@ typedef enum {
 	ABORT_COLLECTION_IDLE_GC
 } CollectionAbortReason;
 
+/**
+ * Concurrent pacing symbols.
+ * Used to explain how the previous concurrent cycle ended relative to free memory
+ * @ingroup GC_Base_Core
+ * @{
+ */
+typedef enum {
+	CONCURRENT_PACING_NO_FEEDBACK = 0,
+	CONCURRENT_PACING_COMPLETED_EARLY,
+	CONCURRENT_PACING_COMPLETED_ON_TIME,
+	CONCURRENT_PACING_NOT_COMPLETED
+} ConcurrentPacingOutcome;
+
 /**
  * Concurrent status symbols.
  * Used explain why tracing stop and card cleaning began
@@ -423,7 +436,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	IDLE_CONTRACT
 } ContractReason;
 
 typedef enum {
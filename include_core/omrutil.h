@@ -343,6 +343,16 @@ uintptr_t getCacheLineSize(void);
 */
 void OMRZeroMemory(void *ptr, uintptr_t length);
 
+/**
+* @brief Zero memory using non-temporal (cache bypassing) stores where the platform has them.
+* Intended for large ranges that will not be touched again soon, so that zeroing them does not evict
+* the caller's working set. Falls back to OMRZeroMemory elsewhere and for short ranges.
+* @param *ptr
+* @param length
+* @return void
+*/
+void OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length);
+
 
 /**
 * @brief
@@ -21,10 +21,13 @@
  *******************************************************************************/
 
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
 #include <algorithm>
 #include <vector>
 #include <iterator>
 #include <numeric>
+#include <string>
 #include <stdio.h>
 
 #include "pugixml.hpp"
@@ -37,13 +40,287 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_PAUSE_TIME = "/verbosegc/exclusive-end";
+const char* XPATH_GET_ALL_PAUSE_INTERVAL = "/verbosegc/exclusive-start";
+const char* XPATH_GET_ALL_ALLOCATED_BYTES = "/verbosegc/allocation-stats";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+const char* OPTION_JSON = "-json=";
+const char* OPTION_BASELINE = "-baseline=";
+const char* OPTION_TOLERANCE = "-tolerance=";
+/* Percentage by which a metric may be worse than its baseline before it counts as a regression */
+#define DEFAULT_REGRESSION_TOLERANCE 10.0
+/* A regression must also exceed this many standard deviations of run to run noise, estimated from the median absolute deviation */
+#define REGRESSION_NOISE_FACTOR 3.0
+#define MAD_TO_STANDARD_DEVIATION 1.4826
+
+#define MAX_CONFIG_NAME_LENGTH 256
+
+/**
+ * Benchmark metrics, each reported as the median and median absolute deviation over the runs of a configuration.
+ */
+enum BenchmarkMetric {
+	METRIC_P50_PAUSE = 0,
+	METRIC_P99_PAUSE,
+	METRIC_MAX_PAUSE,
+	METRIC_THROUGHPUT,
+	METRIC_ALLOCATION_RATE,
+	METRIC_COUNT
+};
+
+struct BenchmarkMetricInfo {
+	const char* key; /**< JSON key */
+	bool higherIsWorse; /**< pauses regress when they grow, throughput and allocation rate when they shrink */
+	bool compared; /**< whether the baseline comparison checks this metric */
+	double floor; /**< smallest change, in the unit of the metric, that counts as a regression */
+};
+
+const BenchmarkMetricInfo METRICS[METRIC_COUNT] = {
+	{"p50PauseMs", true, true, 0.5},
+	{"p99PauseMs", true, true, 1.0},
+	{"maxPauseMs", true, false, 0},
+	{"throughputPercent", false, true, 1.0},
+	{"allocationRateMBps", false, true, 10.0}
+};
+
+/**
+ * Metrics of one run of a collector configuration, derived from its verbose GC log.
+ * Elapsed time runs from verbose GC initialization to the end of the last pause.
+ */
+struct BenchmarkRun {
+	char name[MAX_CONFIG_NAME_LENGTH]; /**< configuration name, the log file name without prefix, pid and timestamp */
+	uintptr_t pauseCount; /**< number of stop-the-world pauses */
+	double elapsed; /**< elapsed time in ms */
+	double metrics[METRIC_COUNT]; /**< pauses in ms, throughput as the percentage of the elapsed time outside pauses, allocation rate in MB/s */
+};
+
+/**
+ * Metrics of a collector configuration over all of its runs.
+ */
+struct BenchmarkResult {
+	char name[MAX_CONFIG_NAME_LENGTH]; /**< configuration name */
+	uintptr_t runs; /**< number of runs */
+	double pauseCount; /**< median number of pauses */
+	double median[METRIC_COUNT]; /**< median of each metric */
+	double mad[METRIC_COUNT]; /**< median absolute deviation of each metric */
+};
+
+/**
+ * A parsed JSON value, enough to read back a results document written by writeJSON.
+ */
+struct JSONValue {
+	enum Type {
+		JSON_NULL = 0,
+		JSON_BOOLEAN,
+		JSON_NUMBER,
+		JSON_STRING,
+		JSON_ARRAY,
+		JSON_OBJECT
+	};
+
+	Type type;
+	double number; /**< value of a number, or 1 and 0 for true and false */
+	std::string string; /**< value of a string */
+	std::vector<JSONValue> elements; /**< elements of an array, or member values of an object */
+	std::vector<std::string> keys; /**< member names of an object, parallel to elements */
+
+	/**
+	 * @return the member of an object with the given name, or NULL if there is none
+	 */
+	const JSONValue* get(const char* key) const
+	{
+		if (JSON_OBJECT == type) {
+			for (size_t i = 0; i < keys.size(); i++) {
+				if (keys[i] == key) {
+					return &elements[i];
+				}
+			}
+		}
+		return NULL;
+	}
+
+	JSONValue() : type(JSON_NULL), number(0) {}
+};
+
+/**
+ * Recursive descent reader for a JSON document (RFC 8259).
+ */
+class JSONReader {
+private:
+	const char* _cursor;
+
+	void skipWhitespace()
+	{
+		while ((' ' == *_cursor) || ('\t' == *_cursor) || ('\n' == *_cursor) || ('\r' == *_cursor)) {
+			_cursor += 1;
+		}
+	}
 
-int main(void)
+	bool consume(char expected)
+	{
+		skipWhitespace();
+		if (expected == *_cursor) {
+			_cursor += 1;
+			return true;
+		}
+		return false;
+	}
+
+	bool parseLiteral(const char* literal)
+	{
+		size_t length = strlen(literal);
+		if (0 == strncmp(_cursor, literal, length)) {
+			_cursor += length;
+			return true;
+		}
+		return false;
+	}
+
+	bool parseString(std::string* string)
+	{
+		if (!consume('"')) {
+			return false;
+		}
+		while ('"' != *_cursor) {
+			char c = *_cursor;
+			if (('\0' == c) || ((unsigned char)c < 0x20)) {
+				return false;
+			}
+			_cursor += 1;
+			if ('\\' == c) {
+				c = *_cursor;
+				_cursor += 1;
+				switch (c) {
+				case '"':
+				case '\\':
+				case '/':
+					break;
+				case 'b':
+					c = '\b';
+					break;
+				case 'f':
+					c = '\f';
+					break;
+				case 'n':
+					c = '\n';
+					break;
+				case 'r':
+					c = '\r';
+					break;
+				case 't':
+					c = '\t';
+					break;
+				case 'u': {
+					/* writeJSON only escapes ASCII control characters */
+					char digits[5] = {0};
+					char* end = NULL;
+					strncpy(digits, _cursor, 4);
+					unsigned long codePoint = strtoul(digits, &end, 16);
+					if ((digits + 4) != end) {
+						return false;
+					}
+					_cursor += 4;
+					c = (codePoint < 0x80) ? (char)codePoint : '?';
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+			string->push_back(c);
+		}
+		_cursor += 1;
+		return true;
+	}
+
+	bool parseValue(JSONValue* value)
+	{
+		skipWhitespace();
+		switch (*_cursor) {
+		case '{':
+			_cursor += 1;
+			value->type = JSONValue::JSON_OBJECT;
+			if (consume('}')) {
+				return true;
+			}
+			do {
+				value->keys.push_back(std::string());
+				value->elements.push_back(JSONValue());
+				if (!parseString(&value->keys.back()) || !consume(':') || !parseValue(&value->elements.back())) {
+					return false;
+				}
+			} while (consume(','));
+			return consume('}');
+		case '[':
+			_cursor += 1;
+			value->type = JSONValue::JSON_ARRAY;
+			if (consume(']')) {
+				return true;
+			}
+			do {
+				value->elements.push_back(JSONValue());
+				if (!parseValue(&value->elements.back())) {
+					return false;
+				}
+			} while (consume(','));
+			return consume(']');
+		case '"':
+			value->type = JSONValue::JSON_STRING;
+			return parseString(&value->string);
+		case 't':
+			value->type = JSONValue::JSON_BOOLEAN;
+			value->number = 1;
+			return parseLiteral("true");
+		case 'f':
+			value->type = JSONValue::JSON_BOOLEAN;
+			return parseLiteral("false");
+		case 'n':
+			return parseLiteral("null");
+		default: {
+			char* end = NULL;
+			if (('-' != *_cursor) && ((*_cursor < '0') || (*_cursor > '9'))) {
+				return false;
+			}
+			value->type = JSONValue::JSON_NUMBER;
+			value->number = strtod(_cursor, &end);
+			if (end == _cursor) {
+				return false;
+			}
+			_cursor = end;
+			return true;
+		}
+		}
+	}
+
+public:
+	/**
+	 * Parse a complete document.
+	 * @return true if the whole text is a single well-formed JSON value
+	 */
+	bool parse(JSONValue* value)
+	{
+		if (!parseValue(value)) {
+			return false;
+		}
+		skipWhitespace();
+		return '\0' == *_cursor;
+	}
+
+	JSONReader(const char* text) : _cursor(text) {}
+};
+
+double getAvg(std::vector<double> v);
+double getPercentile(std::vector<double> v, double percentile);
+double getMedian(std::vector<double> v);
+double getMedianAbsoluteDeviation(std::vector<double> v, double median);
+bool analyze(char* fileName, OMRPortLibrary portLibrary, BenchmarkRun *run);
+void getConfigName(const char* fileName, char* name, uintptr_t nameLength);
+void aggregateRuns(std::vector<BenchmarkRun> &runs, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary);
+bool writeJSON(const char* fileName, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary);
+uintptr_t compareWithBaseline(const char* fileName, std::vector<BenchmarkResult> &results, double tolerance, OMRPortLibrary portLibrary);
+
+int main(int argc, char** argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -51,6 +328,25 @@ int main(void)
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	const char* jsonFile = NULL;
+	const char* baselineFile = NULL;
+	double tolerance = DEFAULT_REGRESSION_TOLERANCE;
+	std::vector<BenchmarkRun> runs;
+	std::vector<BenchmarkResult> results;
+	int exitCode = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], OPTION_JSON, strlen(OPTION_JSON))) {
+			jsonFile = argv[i] + strlen(OPTION_JSON);
+		} else if (0 == strncmp(argv[i], OPTION_BASELINE, strlen(OPTION_BASELINE))) {
+			baselineFile = argv[i] + strlen(OPTION_BASELINE);
+		} else if (0 == strncmp(argv[i], OPTION_TOLERANCE, strlen(OPTION_TOLERANCE))) {
+			tolerance = atof(argv[i] + strlen(OPTION_TOLERANCE));
+		} else {
+			fprintf(stderr, "Usage: %s [%s<results file>] [%s<baseline file>] [%s<percent>]\n", argv[0], OPTION_JSON, OPTION_BASELINE, OPTION_TOLERANCE);
+			return -1;
+		}
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -75,7 +371,10 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			BenchmarkRun run;
+			if (analyze(resultBuffer, portLibrary, &run)) {
+				runs.push_back(run);
+			}
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -90,8 +389,24 @@ int main(void)
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
 	}
 
+	aggregateRuns(runs, results, portLibrary);
+
+	if ((NULL != jsonFile) && !writeJSON(jsonFile, results, portLibrary)) {
+		exitCode = -1;
+	}
+
+	if (NULL != baselineFile) {
+		uintptr_t regressions = compareWithBaseline(baselineFile, results, tolerance, portLibrary);
+		if (0 != regressions) {
+			omrtty_printf("%zu regression(s) against baseline %s\n", regressions, baselineFile);
+			exitCode = 1;
+		}
+	}
+
 	portLibrary.port_shutdown_library(&portLibrary);
 	omrthread_detach(NULL);
+
+	return exitCode;
 }
 
 double
@@ -102,18 +417,95 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+/**
+ * Nearest rank percentile of a sample.
+ */
+double
+getPercentile(std::vector<double> v, double percentile)
+{
+	if (v.empty()) {
+		return 0;
+	}
+	std::sort(v.begin(), v.end());
+	size_t rank = (size_t)ceil((percentile / 100.0) * v.size());
+	if (0 < rank) {
+		rank -= 1;
+	}
+	return v[std::min(rank, v.size() - 1)];
+}
+
+/**
+ * Median of a sample, the mean of the two middle values when the sample size is even.
+ */
+double
+getMedian(std::vector<double> v)
+{
+	if (v.empty()) {
+		return 0;
+	}
+	std::sort(v.begin(), v.end());
+	size_t middle = v.size() / 2;
+	if (0 == (v.size() % 2)) {
+		return (v[middle - 1] + v[middle]) / 2.0;
+	}
+	return v[middle];
+}
+
+/**
+ * Median absolute deviation of a sample from its median, a spread that a single outlying run does not inflate.
+ */
+double
+getMedianAbsoluteDeviation(std::vector<double> v, double median)
+{
+	for (size_t i = 0; i < v.size(); i++) {
+		v[i] = fabs(v[i] - median);
+	}
+	return getMedian(v);
+}
+
+/**
+ * Derive the configuration name from a verbose GC log name of the form
+ * VerboseGC[-_]<name>_<pid>_<timestamp>.xml
+ */
 void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+getConfigName(const char* fileName, char* name, uintptr_t nameLength)
+{
+	const char* start = fileName + strlen(VERBOSE_GC_FILE_PREFIX);
+	if (('-' == *start) || ('_' == *start)) {
+		start += 1;
+	}
+	strncpy(name, start, nameLength - 1);
+	name[nameLength - 1] = '\0';
+
+	char* end = strstr(name, ".xml");
+	if (NULL != end) {
+		*end = '\0';
+	}
+	/* strip the pid and timestamp */
+	for (int i = 0; i < 2; i++) {
+		end = strrchr(name, '_');
+		if (NULL != end) {
+			*end = '\0';
+		}
+	}
+}
+
+bool
+analyze(char* fileName, OMRPortLibrary portLibrary, BenchmarkRun *run)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
+	std::vector<double> pause_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
+	pugi::xpath_node_set pauseTimes;
+	pugi::xpath_node_set pauseIntervals;
+	pugi::xpath_node_set allocatedBytes;
 
 	double maxMark = 0;
 	double minMark = 0;
@@ -131,13 +523,16 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minGCDuration = 0;
 	double avgGCDuration = 0;
 
+	double totalPause = 0;
+	double totalAllocated = 0;
+
 	pugi::xml_document doc;
 	pugi::xml_parse_result result = doc.load_file(fileName);
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
+		return false;
 	} else {
 		omrtty_printf("\nResults for : %s\n",fileName);
 	}
@@ -204,4 +599,239 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	/* Every stop-the-world pause, whatever the collector, is bracketed by exclusive access */
+	pauseTimes = doc.select_nodes(XPATH_GET_ALL_PAUSE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = pauseTimes.begin(); it != pauseTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("durationms").as_double();
+	    pause_values.push_back(value);
+	    totalPause += value;
+	}
+
+	/* Pause start to pause start intervals, the first measured from verbose GC initialization */
+	memset(run, 0, sizeof(BenchmarkRun));
+	pauseIntervals = doc.select_nodes(XPATH_GET_ALL_PAUSE_INTERVAL);
+	for (pugi::xpath_node_set::const_iterator it = pauseIntervals.begin(); it != pauseIntervals.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    run->elapsed += node.node().attribute("intervalms").as_double();
+	}
+	if (!pause_values.empty()) {
+		run->elapsed += pause_values.back();
+	}
+
+	allocatedBytes = doc.select_nodes(XPATH_GET_ALL_ALLOCATED_BYTES);
+	for (pugi::xpath_node_set::const_iterator it = allocatedBytes.begin(); it != allocatedBytes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    totalAllocated += node.node().attribute("totalBytes").as_double();
+	}
+
+	getConfigName(fileName, run->name, sizeof(run->name));
+	run->pauseCount = pause_values.size();
+	run->metrics[METRIC_P50_PAUSE] = getPercentile(pause_values, 50);
+	run->metrics[METRIC_P99_PAUSE] = getPercentile(pause_values, 99);
+	if (!pause_values.empty()) {
+		run->metrics[METRIC_MAX_PAUSE] = *std::max_element(pause_values.begin(), pause_values.end());
+	}
+	if (0 < run->elapsed) {
+		run->metrics[METRIC_THROUGHPUT] = 100.0 * (run->elapsed - totalPause) / run->elapsed;
+		run->metrics[METRIC_ALLOCATION_RATE] = (totalAllocated / (1024.0 * 1024.0)) / (run->elapsed / 1000.0);
+	}
+
+	omrtty_printf("Pauses  : %zu        p50 %f        p99 %f        max %f\n",
+								run->pauseCount, run->metrics[METRIC_P50_PAUSE], run->metrics[METRIC_P99_PAUSE], run->metrics[METRIC_MAX_PAUSE]);
+	omrtty_printf("Elapsed : %f ms        throughput %f%%        allocation rate %f MB/s\n\n",
+								run->elapsed, run->metrics[METRIC_THROUGHPUT], run->metrics[METRIC_ALLOCATION_RATE]);
+
+	return true;
+}
+
+/**
+ * Group the runs by configuration and reduce each metric to its median and median absolute deviation.
+ */
+void
+aggregateRuns(std::vector<BenchmarkRun> &runs, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	std::vector<bool> aggregated(runs.size(), false);
+
+	for (size_t i = 0; i < runs.size(); i++) {
+		if (aggregated[i]) {
+			continue;
+		}
+		std::vector<double> pauseCounts;
+		std::vector<double> values[METRIC_COUNT];
+		for (size_t j = i; j < runs.size(); j++) {
+			if (!aggregated[j] && (0 == strcmp(runs[i].name, runs[j].name))) {
+				aggregated[j] = true;
+				pauseCounts.push_back((double)runs[j].pauseCount);
+				for (uintptr_t m = 0; m < METRIC_COUNT; m++) {
+					values[m].push_back(runs[j].metrics[m]);
+				}
+			}
+		}
+
+		BenchmarkResult result;
+		memset(&result, 0, sizeof(BenchmarkResult));
+		strncpy(result.name, runs[i].name, sizeof(result.name) - 1);
+		result.runs = pauseCounts.size();
+		result.pauseCount = getMedian(pauseCounts);
+		omrtty_printf("%s over %zu run(s):\n", result.name, result.runs);
+		for (uintptr_t m = 0; m < METRIC_COUNT; m++) {
+			result.median[m] = getMedian(values[m]);
+			result.mad[m] = getMedianAbsoluteDeviation(values[m], result.median[m]);
+			omrtty_printf("  %s: median %f, MAD %f\n", METRICS[m].key, result.median[m], result.mad[m]);
+		}
+		results.push_back(result);
+	}
+}
+
+/**
+ * Write a string as a JSON string literal.
+ */
+static void
+writeJSONString(OMRPortLibrary *portLibrary, intptr_t fd, const char* string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrfile_printf(fd, "\"");
+	for (const char* c = string; '\0' != *c; c++) {
+		if (('"' == *c) || ('\\' == *c)) {
+			omrfile_printf(fd, "\\%c", *c);
+		} else if ((unsigned char)*c < 0x20) {
+			omrfile_printf(fd, "\\u%04x", (unsigned int)(unsigned char)*c);
+		} else {
+			omrfile_printf(fd, "%c", *c);
+		}
+	}
+	omrfile_printf(fd, "\"");
+}
+
+/**
+ * Write the results as a JSON document with one object per configuration.
+ */
+bool
+writeJSON(const char* fileName, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		omrtty_printf("Failed to open results file %s\n", fileName);
+		return false;
+	}
+
+	omrfile_printf(fd, "{\n  \"configurations\": [\n");
+	for (size_t i = 0; i < results.size(); i++) {
+		BenchmarkResult *result = &results[i];
+		omrfile_printf(fd, "    {\n");
+		omrfile_printf(fd, "      \"name\": ");
+		writeJSONString(&portLibrary, fd, result->name);
+		omrfile_printf(fd, ",\n");
+		omrfile_printf(fd, "      \"runs\": %zu,\n", result->runs);
+		omrfile_printf(fd, "      \"pauseCount\": %.1f", result->pauseCount);
+		for (uintptr_t m = 0; m < METRIC_COUNT; m++) {
+			omrfile_printf(fd, ",\n      \"%s\": {\"median\": %.3f, \"mad\": %.3f}", METRICS[m].key, result->median[m], result->mad[m]);
+		}
+		omrfile_printf(fd, "\n    }%s\n", ((i + 1) < results.size()) ? "," : "");
+	}
+	omrfile_printf(fd, "  ]\n}\n");
+	omrfile_close(fd);
+
+	return true;
+}
+
+/**
+ * Find the median and median absolute deviation of a metric of a configuration in a results document written by writeJSON.
+ */
+static bool
+findBaselineMetric(const JSONValue &baseline, const char* name, const char* key, double* median, double* mad)
+{
+	const JSONValue* configurations = baseline.get("configurations");
+	if ((NULL == configurations) || (JSONValue::JSON_ARRAY != configurations->type)) {
+		return false;
+	}
+	for (size_t i = 0; i < configurations->elements.size(); i++) {
+		const JSONValue* configName = configurations->elements[i].get("name");
+		if ((NULL != configName) && (JSONValue::JSON_STRING == configName->type) && (configName->string == name)) {
+			const JSONValue* metric = configurations->elements[i].get(key);
+			const JSONValue* metricMedian = (NULL != metric) ? metric->get("median") : NULL;
+			const JSONValue* metricMad = (NULL != metric) ? metric->get("mad") : NULL;
+			if ((NULL == metricMedian) || (JSONValue::JSON_NUMBER != metricMedian->type)) {
+				return false;
+			}
+			*median = metricMedian->number;
+			*mad = ((NULL != metricMad) && (JSONValue::JSON_NUMBER == metricMad->type)) ? metricMad->number : 0;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Compare each result against the same configuration in a baseline written by writeJSON.
+ * A metric regresses when its median is worse than the baseline median by more than the largest of
+ * tolerance percent of the baseline, REGRESSION_NOISE_FACTOR standard deviations of the run to run noise
+ * of either side, and the absolute floor of the metric, so noisy and near zero metrics do not fail spuriously.
+ * @return the number of regressed metrics
+ */
+uintptr_t
+compareWithBaseline(const char* fileName, std::vector<BenchmarkResult> &results, double tolerance, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	uintptr_t regressions = 0;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		omrtty_printf("Failed to open baseline file %s\n", fileName);
+		return 1;
+	}
+	int64_t length = omrfile_flength(fd);
+	char* text = (char*)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+	if (NULL == text) {
+		omrfile_close(fd);
+		return 1;
+	}
+	intptr_t bytesRead = omrfile_read(fd, text, (intptr_t)length);
+	text[(bytesRead > 0) ? bytesRead : 0] = '\0';
+	omrfile_close(fd);
+
+	JSONValue baseline;
+	JSONReader reader(text);
+	bool parsed = reader.parse(&baseline);
+	omrmem_free_memory(text);
+	if (!parsed) {
+		omrtty_printf("Baseline file %s is not valid JSON\n", fileName);
+		return 1;
+	}
+
+	omrtty_printf("Comparing against baseline %s (tolerance %f%%)\n", fileName, tolerance);
+	for (size_t i = 0; i < results.size(); i++) {
+		BenchmarkResult *result = &results[i];
+		for (uintptr_t m = 0; m < METRIC_COUNT; m++) {
+			if (!METRICS[m].compared) {
+				continue;
+			}
+			double expected = 0;
+			double expectedMad = 0;
+			if (!findBaselineMetric(baseline, result->name, METRICS[m].key, &expected, &expectedMad)) {
+				omrtty_printf("  %s %s: no baseline\n", result->name, METRICS[m].key);
+				continue;
+			}
+			double noise = REGRESSION_NOISE_FACTOR * MAD_TO_STANDARD_DEVIATION * std::max(expectedMad, result->mad[m]);
+			double allowed = std::max(std::max(fabs(expected) * (tolerance / 100.0), noise), METRICS[m].floor);
+			double current = result->median[m];
+			bool regressed = false;
+			if (METRICS[m].higherIsWorse) {
+				regressed = current > (expected + allowed);
+			} else {
+				regressed = current < (expected - allowed);
+			}
+			omrtty_printf("  %s %s: %f (baseline %f, allowed change %f)%s\n", result->name, METRICS[m].key, current, expected, allowed, regressed ? " REGRESSION" : "");
+			if (regressed) {
+				regressions += 1;
+			}
+		}
+	}
+
+	return regressions;
 }
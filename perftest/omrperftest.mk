@@ -41,9 +41,35 @@ endif
 ######################J9 Lab specific settings#################################
 
 all: test
-	
-omr_perfgctest:
+
+# The benchmark workload runs PERFGCTEST_RUNS times for every combination of PERFGCTEST_POLICIES,
+# PERFGCTEST_HEAP_SIZES (MB) and PERFGCTEST_THREADS, and each metric is reduced to its median and
+# median absolute deviation over the runs. Results are written to PERFGCTEST_RESULTS. If PERFGCTEST_BASELINE
+# exists, omr_perfgctest fails when a median is worse than the baseline by more than PERFGCTEST_TOLERANCE
+# percent, three standard deviations of the run to run noise and the absolute floor of the metric.
+PERFGCTEST_RESULTS ?= perfgctest_results.json
+PERFGCTEST_BASELINE ?= perfgctest_baseline.json
+PERFGCTEST_TOLERANCE ?= 10
+PERFGCTEST_RUNS ?= 5
+PERFGCTEST_POLICIES ?= optavgpause gencon
+PERFGCTEST_HEAP_SIZES ?= 16 64
+PERFGCTEST_THREADS ?= 1 4
+
+omr_perfgctest_run:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
-	./omrperfgctest
+	for policy in $(PERFGCTEST_POLICIES); do \
+		for heap in $(PERFGCTEST_HEAP_SIZES); do \
+			for threads in $(PERFGCTEST_THREADS); do \
+				./omrgctest --gtest_filter="benchmarkTest*" --gtest_repeat=$(PERFGCTEST_RUNS) -keepVerboseLog \
+					-GCPolicy=$$policy -memoryMax=$$heap -gcthreadCount=$$threads || exit 1; \
+			done; \
+		done; \
+	done
+
+omr_perfgctest: omr_perfgctest_run
+	./omrperfgctest -json=$(PERFGCTEST_RESULTS) -tolerance=$(PERFGCTEST_TOLERANCE) $(if $(wildcard $(PERFGCTEST_BASELINE)),-baseline=$(PERFGCTEST_BASELINE))
+
+omr_perfgctest_baseline: omr_perfgctest_run
+	./omrperfgctest -json=$(PERFGCTEST_BASELINE)
 
-.PHONY: all test omr_perfgctest 
+.PHONY: all test omr_perfgctest_run omr_perfgctest omr_perfgctest_baseline 
@@ -29,6 +29,10 @@
 #endif /* defined(J9ZOS390) || (defined(LINUX) && defined(S390)) */
 #include <string.h>
 
+#if defined(J9HAMMER)
+#include <emmintrin.h>
+#endif /* defined(J9HAMMER) */
+
 #if defined(J9ZOS39064)
 #include "omrgcconsts.h"
 #include "omriarv64.h"
@@ -144,6 +148,35 @@ OMRZeroMemory(void *ptr, uintptr_t length)
 }
 
 
+void
+OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length)
+{
+#if defined(J9HAMMER)
+	/* SSE2 is part of the x86-64 baseline, so streaming stores are always available */
+	char *addr = static_cast<char*>(ptr);
+	char *end = addr + length;
+	char *alignedStart = (char *)(((uintptr_t)addr + 15) & ~(uintptr_t)15);
+	char *alignedEnd = (char *)((uintptr_t)end & ~(uintptr_t)15);
+
+	/* Streaming only pays off for a run of whole lines; leave short ranges to the cached path */
+	if ((alignedEnd - alignedStart) < (intptr_t)(4 * 64)) {
+		OMRZeroMemory(ptr, length);
+		return;
+	}
+
+	memset(addr, 0, (size_t)(alignedStart - addr));
+	__m128i zero = _mm_setzero_si128();
+	for (; alignedStart < alignedEnd; alignedStart += 16) {
+		_mm_stream_si128((__m128i *)alignedStart, zero);
+	}
+	memset(alignedEnd, 0, (size_t)(end - alignedEnd));
+	/* order the weakly ordered streaming stores before any later store that publishes the memory */
+	_mm_sfence();
+#else /* defined(J9HAMMER) */
+	OMRZeroMemory(ptr, length);
+#endif /* defined(J9HAMMER) */
+}
+
 uintptr_t
 getCacheLineSize(void)
 {